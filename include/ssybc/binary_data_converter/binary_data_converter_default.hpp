@@ -25,6 +25,7 @@
 
 #include <string>
 #include <exception>
+#include <stdexcept>
 
 namespace ssybc {
 
@@ -32,6 +32,9 @@
 
 namespace ssybc {
 
+  template<typename, HashDifficulty, template<typename, HashDifficulty> class>
+  class Blockchain;
+
   template<
     typename DataT,
     template<typename> class ContentBinaryConverterTemplate = BinaryDataConverterDefault,
@@ -109,7 +112,7 @@ namespace ssybc {
 // --------------------------------------------------- Public Method --------------------------------------------------
 
     bool IsHeaderOnly() const;
-    BlockHeaderType Header() const;
+    BlockHeaderType const &Header() const;
     BlockContentType Content() const;
 
     BinaryData Binary() const;
@@ -125,6 +128,21 @@ namespace ssybc {
 
   private:
 
+// ------------------------------------------------------ Friend ------------------------------------------------------
+
+    // Loads blocks with header hashes it calculated in batches, and skips the merkle check of checkpointed blocks.
+    template<typename, HashDifficulty, template<typename, HashDifficulty> class>
+    friend class Blockchain;
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+    // Same as Block(BinaryData &&), "header_hash" must be the hash of the header part of "binary_data". Not public, a
+    // caller could pass any hash and skip the proof of work.
+    Block(BinaryData &&binary_data, BlockHash const &header_hash);
+    // Same as above, does not compare the hash of the content with the merkle root if "verifies_content" is false, for
+    // blocks covered by a checkpoint when loading a chain.
+    Block(BinaryData &&binary_data, BlockHash const &header_hash, bool const verifies_content);
+
 // -------------------------------------------------- Private Field ---------------------------------------------------
 
     BlockHeaderType const header_;
@@ -133,6 +151,7 @@ namespace ssybc {
 // -------------------------------------------------- Private Method --------------------------------------------------
 
     BlockHeaderType HeaderFromBinaryData_(BinaryData &&binary_data) const;
+    BlockHeaderType HeaderFromBinaryData_(BinaryData &&binary_data, BlockHash const &header_hash) const;
     std::unique_ptr<BlockContentType const> ContentPtrFromBinaryData_(BinaryData &&binary_data) const;
     void ThrowContentHashDoesNotMatchMerkleRootException_() const;
   };
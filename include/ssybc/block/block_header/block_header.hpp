@@ -29,6 +29,9 @@
 
 namespace ssybc {
 
+  template<typename, template<typename> class, typename, typename>
+  class Block;
+
   template<typename HashCalculatorT>
   class BlockHeader {
 
@@ -94,6 +97,18 @@ namespace ssybc {
 
   private:
 
+// ------------------------------------------------------ Friend ------------------------------------------------------
+
+    // Only constructs headers with hashes it calculated itself.
+    template<typename, template<typename> class, typename, typename>
+    friend class Block;
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+    // "hash" must be the hash of "binary_data", e.g. one calculated in a batch with HashCalculator::HashBatch(). Not
+    // public, a caller could pass any hash and skip the proof of work.
+    BlockHeader(BinaryData const &binary_data, BlockHash const &hash);
+
 // -------------------------------------------------- Private Field ---------------------------------------------------
 
     BlockVersion const version_;
@@ -0,0 +1,91 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_INCLUDE_SSYBC_BLOCKCHAIN_BLOCK_STREAM_READER_BLOCK_STREAM_READER_HPP_
+#define SSYBC_INCLUDE_SSYBC_BLOCKCHAIN_BLOCK_STREAM_READER_BLOCK_STREAM_READER_HPP_
+
+#include "include/ssybc/general/general.hpp"
+
+#include <istream>
+
+namespace ssybc {
+
+  // Splits serialized blocks, as written by Blockchain::Binary(), into one binary per block in a single forward pass,
+  // each block is a header, the size of its content and the content. Reads from a buffer without copying it, or from
+  // a stream holding no more than one block in memory.
+  template<typename BlockT>
+  class BlockStreamReader {
+  public:
+
+// -------------------------------------------------- Type Definition -------------------------------------------------
+
+    using BlockType = BlockT;
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+    // "binary_data" and "stream" must outlive the reader.
+    explicit BlockStreamReader(BinaryData const &binary_data);
+    explicit BlockStreamReader(std::istream &stream);
+    BlockStreamReader(BlockStreamReader const &reader) = delete;
+    BlockStreamReader(BlockStreamReader &&reader) = delete;
+
+    ~BlockStreamReader() = default;
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+    // Replaces "block_binary" with the next block, returns false at the end of the data. Throws std::runtime_error if
+    // the data ends in the middle of a block.
+    bool NextBlockBinary(BinaryData &block_binary);
+
+    // Same as above, but only reports where the next block is, without copying its content.
+    bool NextBlockExtent(SizeT &block_offset, SizeT &block_size);
+
+    // Bytes consumed so far.
+    SizeT Offset() const;
+
+    BlockStreamReader& operator=(BlockStreamReader const &) = delete;
+    BlockStreamReader& operator=(BlockStreamReader &&) = delete;
+
+  private:
+
+// -------------------------------------------------- Private Field ---------------------------------------------------
+
+    Byte const * const data_{ nullptr };
+    SizeT const data_size_{ 0 };
+    std::istream * const stream_ptr_{ nullptr };
+    SizeT offset_{ 0 };
+
+// -------------------------------------------------- Private Method --------------------------------------------------
+
+    // Appends "size" bytes to "binary_data". Returns false if the data ends first, after appending what is left.
+    bool ReadBytes_(BinaryData &binary_data, SizeT const size);
+    bool SkipBytes_(SizeT const size);
+    // Reads the header and content size of the next block into "block_binary", returns the content size.
+    SizeT ReadHeaderAndContentSize_(BinaryData &block_binary);
+    bool IsAtEnd_();
+  };
+
+}  // namespace ssybc
+
+
+#include "src/blockchain/block_stream_reader/block_stream_reader_impl.hpp"
+
+
+#endif  // SSYBC_INCLUDE_SSYBC_BLOCKCHAIN_BLOCK_STREAM_READER_BLOCK_STREAM_READER_HPP_
@@ -25,14 +25,27 @@
 #include "include/ssybc/block/block.hpp"
 #include "include/ssybc/validator/block_validator_less_hash.hpp"
 #include "include/ssybc/miner/block_miner_cpu_brute_force.hpp"
+#include "include/ssybc/miner/miner_registry.hpp"
+#include "include/ssybc/miner/mining_job.hpp"
+#include "include/ssybc/miner/mining_thread_pool.hpp"
 #include "include/ssybc/blockchain/blockchain_iterator/blockchain_iterator.hpp"
+#include "include/ssybc/blockchain/block_stream_reader/block_stream_reader.hpp"
+#include "include/ssybc/blockchain/blockchain_checkpoints/blockchain_checkpoints.hpp"
 
 #include <unordered_map>
 #include <string>
 #include <memory>
+#include <chrono>
+#include <future>
+#include <istream>
 
 namespace ssybc {
 
+  // Blocks parsed and header-hashed at once while loading a chain.
+  constexpr SizeT kBlockLoadingBatchSize{ 1024 };
+  // Blocks a worker takes at once while loading a chain on a thread pool.
+  constexpr SizeT kParallelBlockLoadingChunkSize{ 64 };
+
   template<
     typename BlockT,
     HashDifficulty Difficulty = 2,
@@ -50,6 +63,7 @@ namespace ssybc {
     using ContentHashCalculatorType = typename BlockType::ContentHashCalculatorType;
     using ValidatorType = ValidatorTemplate<BlockType, Difficulty>;
     using MinerType = BlockMiner<ValidatorType>;
+    using ValidationCacheType = ValidationCache<typename BlockType::BlockHeaderType>;
 
 // --------------------------------------------- Constructor & Destructor ---------------------------------------------
 
@@ -58,6 +72,20 @@ namespace ssybc {
 
     Blockchain(BinaryData const &binary_data);
     Blockchain(BinaryData &&binary_data);
+    // Reads blocks as written by Binary() until the end of "stream", without holding the serialized chain in memory.
+    explicit Blockchain(std::istream &stream);
+    // Finds where every block starts first, then parses, hashes and checks the blocks on all workers of
+    // "thread_pool_ptr", and checks how they link to each other last.
+    Blockchain(BinaryData const &binary_data, std::shared_ptr<MiningThreadPool> const &thread_pool_ptr);
+    // Same as above, blocks covered by "checkpoints" get their header hashes, proof of work and links checked, but
+    // not their merkle roots. Throws std::logic_error if a header hash differs from its checkpoint, or if the data
+    // ends below the highest checkpoint.
+    Blockchain(BinaryData const &binary_data, BlockchainCheckpoints const &checkpoints);
+    Blockchain(std::istream &stream, BlockchainCheckpoints const &checkpoints);
+    Blockchain(
+      BinaryData const &binary_data,
+      std::shared_ptr<MiningThreadPool> const &thread_pool_ptr,
+      BlockchainCheckpoints const &checkpoints);
 
     ~Blockchain();
 
@@ -68,16 +96,37 @@ namespace ssybc {
     std::shared_ptr<MinerType> MinerPtr() const;
     template<typename ConcreteMinerType>
     void SetMiner(ConcreteMinerType const &miner);
+    void SetMinerPtr(std::shared_ptr<MinerType> const &miner_ptr);
+    // Miner registered in MinerRegistry<ValidatorType>::Default() as "miner_name", or kAutoMinerName. Throws
+    // std::invalid_argument if there is none.
+    void SetMinerByName(std::string const &miner_name);
+
+    // Cache consulted by Append() and AppendBlocks(), which can be shared with other chains and validators. None by
+    // default, null removes it.
+    std::shared_ptr<ValidationCacheType> ValidationCachePtr() const;
+    void SetValidationCachePtr(std::shared_ptr<ValidationCacheType> const &cache_ptr);
 
     bool Append(BlockType const &block);
     bool Append(BlockDataType const &data);
+    // Appends the longest valid prefix of "blocks", validated with one batch of header hashes, returns its size.
+    SizeT AppendBlocks(std::vector<BlockType> const &blocks);
+    // Same as above, hashing on all workers of "thread_pool".
+    SizeT AppendBlocks(std::vector<BlockType> const &blocks, MiningThreadPool &thread_pool);
+
+    // Mines the block after the current tail on another thread and returns right away, the caller appends the
+    // result with Append(job.Get()). Append() rejects the block if the tail has changed since, cancel stale jobs.
+    MiningJob<BlockType> MineAsync(BlockDataType const &data) const;
+    MiningJob<BlockType> MineAsync(
+      BlockDataType const &data,
+      std::chrono::steady_clock::time_point const deadline) const;
 
     operator std::string() const;
     virtual std::string Description() const;
 
     BlockType operator[](long long const index) const;
+    // Throws std::invalid_argument if "hash_string" is not the hex string of a BlockHash, i.e. 64 hex digits.
     BlockType operator[](std::string const &hash_string);
-    BlockType operator[](BinaryData const &hash);
+    BlockType operator[](BlockHash const &hash);
 
     bool operator==(Blockchain const &blockchain) const;
     bool operator!=(Blockchain const &blockchain) const;
@@ -90,26 +139,54 @@ namespace ssybc {
 
     Blockchain BlockchainHeadersOnly() const;
 
+    // Checkpoint at the tail block, which vouches for the whole chain.
+    BlockchainCheckpoints TailCheckpoint() const;
+    // Validates every block again, including the merkle roots not checked for blocks covered by checkpoints.
+    bool Verify() const;
+    // Same as above, on another thread with a copy of the chain, which can keep changing meanwhile.
+    std::future<bool> VerifyAsync() const;
+
     BinaryData Binary() const;
     BinaryData BinaryHeadersOnly() const;
 
     bool SaveBinaryToFileAtPath(std::string const &file_path);
     bool SaveHeadersOnlyBinaryToFileAtPath(std::string const &file_path);
+    // Also saves TailCheckpoint() to BlockchainCheckpoints::SidecarFilePath(file_path).
+    bool SaveBinaryAndCheckpointToFileAtPath(std::string const &file_path);
 
+    // Mines on MiningThreadPool::Default(), so calls from different threads mine one after another.
     static BlockType GenesisBlockMinedWithData(BlockDataType const &data);
     static BlockType GenesisBlockMinedWithData(BlockDataType const &data, MinerType const &miner);
 
+    // Streams the file, throws std::runtime_error if it cannot be opened or ends in the middle of a block.
     static Blockchain LoadFromBinaryFileAtPath(std::string const &file_path);
+    // Reads the whole file into memory and loads it on "thread_pool_ptr", faster on many cores but not streamed.
+    static Blockchain LoadFromBinaryFileAtPath(
+      std::string const &file_path,
+      std::shared_ptr<MiningThreadPool> const &thread_pool_ptr);
+    // Streams the file like above, trusting the blocks covered by "checkpoints".
+    static Blockchain LoadFromBinaryFileAtPath(std::string const &file_path, BlockchainCheckpoints const &checkpoints);
+    // Same as above, with the checkpoints in the sidecar file of "file_path", if any.
+    static Blockchain LoadFromBinaryFileAtPathWithCheckpoints(std::string const &file_path);
 
 // -------------------------------------------------- Private Member --------------------------------------------------
 
   private:
 
     std::vector<BlockType> blocks_{};
-    std::unordered_map<std::string, std::size_t> hash_to_index_dict_{};
+    std::unordered_map<BlockHash, std::size_t> hash_to_index_dict_{};
     std::shared_ptr<MinerType> miner_ptr_{ std::make_shared<decltype(DefaultMiner_())>(DefaultMiner_()) };
+    std::shared_ptr<ValidationCacheType> validation_cache_ptr_{};
 
+    ValidatorType Validator_() const;
     void PushBackBlock_(BlockType const &block);
+    void PushBackBlock_(BlockType &&block);
+    void AppendBlocksFromReader_(BlockStreamReader<BlockType> &reader, BlockchainCheckpoints const &checkpoints);
+    void AppendBlocksInParallel_(
+      BinaryData const &binary_data,
+      MiningThreadPool &thread_pool,
+      BlockchainCheckpoints const &checkpoints);
+    void ThrowIfBelowHighestCheckpoint_(BlockchainCheckpoints const &checkpoints) const;
     static BlockMinerCPUBruteForce<ValidatorType> DefaultMiner_();
     static BlockType BlockInitializedWithData_(
       BlockDataType const &data,
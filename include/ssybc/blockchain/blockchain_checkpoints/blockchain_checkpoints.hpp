@@ -0,0 +1,85 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_INCLUDE_SSYBC_BLOCKCHAIN_BLOCKCHAIN_CHECKPOINTS_BLOCKCHAIN_CHECKPOINTS_HPP_
+#define SSYBC_INCLUDE_SSYBC_BLOCKCHAIN_BLOCKCHAIN_CHECKPOINTS_BLOCKCHAIN_CHECKPOINTS_HPP_
+
+#include "include/ssybc/general/general.hpp"
+
+#include <map>
+#include <string>
+
+namespace ssybc {
+
+  // Extension of the sidecar file holding the checkpoints of a chain file, see SidecarFilePath().
+  constexpr char const *kCheckpointsFileExtension{ ".checkpoints" };
+
+  // Header hashes of blocks at known heights, recorded from a chain that was fully validated before. A header hash
+  // covers the previous hash, so a checkpoint vouches for every header at or below its height once the hash chain
+  // leading to it is intact. Blockchain trusts the content of those blocks and skips their merkle root checks when
+  // loading, see Blockchain::Verify() to check them later.
+  class BlockchainCheckpoints {
+  public:
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+    BlockchainCheckpoints() = default;
+    // Parses the text written by Text(). Throws std::invalid_argument if it is malformed.
+    explicit BlockchainCheckpoints(std::string const &text);
+
+    ~BlockchainCheckpoints() = default;
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+    // Replaces the checkpoint at "height", if any.
+    void Add(BlockIndex const height, BlockHash const &header_hash);
+
+    SizeT Size() const;
+    bool IsEmpty() const;
+    // Throws std::logic_error if there are no checkpoints.
+    BlockIndex HighestHeight() const;
+    // Blocks at or below HighestHeight() are covered.
+    bool Covers(BlockIndex const height) const;
+    // False only if there is a checkpoint at "height" with another hash.
+    bool IsConsistentWith(BlockIndex const height, BlockHash const &header_hash) const;
+
+    // One "<height> <hex header hash>" line per checkpoint, lowest height first.
+    std::string Text() const;
+
+    bool SaveToFileAtPath(std::string const &file_path) const;
+    // No checkpoints if there is no file at "file_path". Throws std::invalid_argument if the file is malformed.
+    static BlockchainCheckpoints LoadFromFileAtPath(std::string const &file_path);
+    // Where the checkpoints of the chain saved at "chain_file_path" are kept.
+    static std::string SidecarFilePath(std::string const &chain_file_path);
+
+  private:
+
+// -------------------------------------------------- Private Field ---------------------------------------------------
+
+    std::map<BlockIndex, BlockHash> hash_at_height_dict_{};
+  };
+
+}  // namespace ssybc
+
+
+#include "src/blockchain/blockchain_checkpoints/blockchain_checkpoints_impl.hpp"
+
+
+#endif  // SSYBC_INCLUDE_SSYBC_BLOCKCHAIN_BLOCKCHAIN_CHECKPOINTS_BLOCKCHAIN_CHECKPOINTS_HPP_
@@ -0,0 +1,113 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_INCLUDE_SSYBC_GENERAL_BLOCK_HASH_HPP_
+#define SSYBC_INCLUDE_SSYBC_GENERAL_BLOCK_HASH_HPP_
+
+#include "include/ssybc/general/general.hpp"
+
+#include <cstdint>
+#include <functional>
+
+namespace ssybc {
+
+  constexpr std::size_t kSizeOfBlockHashInBytes{ 32 };
+
+  // Fixed size hash value, big enough for a SHA-256 digest. Trivially copyable, so block headers hold their hashes
+  // inline instead of in heap buffers, and aligned to 64-bit words, which is what equality compares.
+  class alignas(std::uint64_t) BlockHash {
+  public:
+
+// -------------------------------------------------- Type Definition -------------------------------------------------
+
+    using value_type = Byte;
+    using iterator = Byte *;
+    using const_iterator = Byte const *;
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+    // All bytes zero.
+    BlockHash();
+
+    // "size" must be kSizeOfBlockHashInBytes.
+    BlockHash(Byte const *data, SizeT const size);
+    explicit BlockHash(BinaryData const &binary_data);
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+    static constexpr std::size_t size() { return kSizeOfBlockHashInBytes; }
+
+    Byte *data();
+    Byte const *data() const;
+
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    Byte &operator[](std::size_t const index);
+    Byte const &operator[](std::size_t const index) const;
+
+    BinaryData Binary() const;
+
+    // Negative, zero or positive if this hash is less than, equal to or greater than "hash" as big-endian numbers.
+    // Compares in place a 64-bit word at a time, for validators that run on every mining attempt.
+    int Compare(BlockHash const &hash) const;
+
+    // Number of leading zero bits of the hash as a big-endian number, without data dependent branches.
+    SizeT LeadingZeroBits() const;
+
+    bool operator==(BlockHash const &hash) const;
+    bool operator!=(BlockHash const &hash) const;
+
+    bool operator<(BlockHash const &hash) const;
+    bool operator<=(BlockHash const &hash) const;
+    bool operator>(BlockHash const &hash) const;
+    bool operator>=(BlockHash const &hash) const;
+
+  private:
+
+// -------------------------------------------------- Private Field ---------------------------------------------------
+
+    Byte bytes_[kSizeOfBlockHashInBytes];
+
+// -------------------------------------------------- Private Method --------------------------------------------------
+
+    std::uint64_t Word_(std::size_t const index) const;
+    std::uint64_t BigEndianWord_(std::size_t const index) const;
+    static std::uint64_t CountLeadingZeros_(std::uint64_t const word);
+  };
+
+}  // namespace ssybc
+
+
+namespace std {
+
+  template<>
+  struct hash<ssybc::BlockHash> {
+    std::size_t operator()(ssybc::BlockHash const &hash) const;
+  };
+
+}  // namespace std
+
+
+#include "src/general/block_hash_impl.hpp"
+
+#endif  // SSYBC_INCLUDE_SSYBC_GENERAL_BLOCK_HASH_HPP_
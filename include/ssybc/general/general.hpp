@@ -38,7 +38,7 @@ namespace ssybc {
   using BlockNonce = uint64_t;
   using Byte = unsigned char;
   using BinaryData = std::vector<Byte>;
-  using BlockHash = BinaryData;
+  class BlockHash;
   using HashDifficulty = unsigned short;
 
   constexpr unsigned char kNumberOfBitsInByte{8};
@@ -54,5 +54,7 @@ namespace ssybc {
 
 }  // namespace ssybc
 
+#include "include/ssybc/general/block_hash.hpp"
+
 #endif  // SSYBC_INCLUDE_SSYBC_GENERAL_GENERAL_HPP_
 
@@ -23,6 +23,8 @@
 
 #include "include/ssybc/general/general.hpp"
 
+#include <memory>
+
 namespace ssybc {
 
   class HashCalculatorInterface {
@@ -31,10 +33,28 @@ namespace ssybc {
     virtual BlockHash Hash(BinaryData const data) const = 0;
     virtual BlockHash GenesisBlockPreviousHash() const = 0;
 
+    // Allocation-free hashing of "size" bytes at "data" into "hash". The default implementations go through Hash(),
+    // hash functions should override them.
+    virtual void HashInto(Byte const *data, SizeT const size, BlockHash &hash) const;
+    virtual void HashBatchInto(Byte const *const messages[], SizeT const count, SizeT const size, BlockHash hashes[]) const;
+
+    // Hashes independent messages, implementations may hash BatchLaneCount() messages at a time with SIMD.
+    virtual SizeT BatchLaneCount() const;
+    virtual std::vector<BlockHash> HashBatch(std::vector<BinaryData> const &data) const;
+
+    // Returns a calculator for messages that all start with "prefix", which only hashes the prefix once (e.g. the
+    // SHA-256 midstate), or nullptr if the hash function cannot take advantage of it. Miners use it because only the
+    // trailing time stamp and nonce change between attempts.
+    virtual std::unique_ptr<HashCalculatorInterface const> CalculatorWithFixedPrefix(BinaryData const &prefix) const;
+
     virtual ~HashCalculatorInterface() { EMPTY_BLOCK }
   };
 
 }  // namespace ssybc
 
+
+#include "src/hash_calculator/hash_calculator_interface_impl.hpp"
+
+
 #endif  // SSYBC_INCLUDE_SSYBC_HASH_CALCULATOR_HASH_CALCULATOR_INTERFACE_HPP_
 
@@ -32,6 +32,20 @@ namespace ssybc {
     SizeT SizeOfHashInBytes() const override final;
     BlockHash Hash(BinaryData const data) const override final;
     BlockHash GenesisBlockPreviousHash() const override final;
+
+    void HashInto(Byte const *data, SizeT const size, BlockHash &hash) const override final;
+    void HashBatchInto(
+      Byte const *const messages[],
+      SizeT const count,
+      SizeT const size,
+      BlockHash hashes[]) const override final;
+
+    SizeT BatchLaneCount() const override final;
+    std::unique_ptr<HashCalculatorInterface const> CalculatorWithFixedPrefix(
+      BinaryData const &prefix) const override final;
+
+    static std::string BackendName();
+    static std::string BatchBackendName();
   };
 
 }  // namespace ssybc
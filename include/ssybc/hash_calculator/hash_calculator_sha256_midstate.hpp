@@ -0,0 +1,67 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_INCLUDE_SSYBC_HASH_CALCULATOR_HASH_CALCULATOR_SHA256_MIDSTATE_HPP_
+#define SSYBC_INCLUDE_SSYBC_HASH_CALCULATOR_HASH_CALCULATOR_SHA256_MIDSTATE_HPP_
+
+#include "include/ssybc/hash_calculator/hash_calculator_interface.hpp"
+#include "library/sha256/sha256.hpp"
+
+#include <array>
+
+namespace ssybc {
+
+  // (Double) SHA-256 of messages that all start with the same prefix. The whole 64-byte blocks of the prefix are
+  // compressed once at construction, every Hash() call only compresses what comes after them. Messages passed in
+  // must start with the prefix, it is not checked.
+  class SHA256MidstateCalculator: public virtual HashCalculatorInterface {
+  public:
+    SHA256MidstateCalculator() = delete;
+    SHA256MidstateCalculator(BinaryData const &prefix, bool const is_double_sha256);
+
+    SizeT SizeOfHashInBytes() const override final;
+    BlockHash Hash(BinaryData const data) const override final;
+    BlockHash GenesisBlockPreviousHash() const override final;
+
+    void HashInto(Byte const *data, SizeT const size, BlockHash &hash) const override final;
+    void HashBatchInto(
+      Byte const *const messages[],
+      SizeT const count,
+      SizeT const size,
+      BlockHash hashes[]) const override final;
+
+    SizeT BatchLaneCount() const override final;
+
+  private:
+
+// -------------------------------------------------- Private Field ---------------------------------------------------
+
+    bool const is_double_sha256_;
+    SizeT const prefix_size_;
+    std::array<WORD, 8> midstate_;
+  };
+
+}  // namespace ssybc
+
+
+#include "src/hash_calculator/hash_calculator_sha256_midstate_impl.hpp"
+
+
+#endif  // SSYBC_INCLUDE_SSYBC_HASH_CALCULATOR_HASH_CALCULATOR_SHA256_MIDSTATE_HPP_
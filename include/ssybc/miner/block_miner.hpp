@@ -22,15 +22,11 @@
 #define SSYBC_INCLUDE_SSYBC_MINER_BLOCK_MINER_HPP_
 
 #include "include/ssybc/general/general.hpp"
+#include "include/ssybc/miner/mined_result.hpp"
+#include "include/ssybc/miner/mining_session.hpp"
 
 namespace ssybc {
 
-  struct MinedResult {
-  public:
-    BlockTimeInterval time_stamp{};
-    BlockNonce nonce{};
-  };
-
   template<typename Validator>
   class BlockMiner {
   public:
@@ -49,9 +45,22 @@ namespace ssybc {
     virtual MinedResult MineGenesisInfo(BinaryData const &hashable_binary) const = 0;
     virtual MinedResult MineInfo(BlockHash const &previous_hash, BinaryData const &hashable_binary) const = 0;
 
+    // Same as above, but give up once "session" is stopped, the result is only valid if session.HasResult(). The
+    // default implementation publishes the result of the overload above and only notices a stop when that returns,
+    // miners override these for prompt cancellation. It also ignores the nonce range of "session".
+    virtual MinedResult MineGenesisInfo(BinaryData const &hashable_binary, MiningSession &session) const;
+    virtual MinedResult MineInfo(
+      BlockHash const &previous_hash,
+      BinaryData const &hashable_binary,
+      MiningSession &session) const;
+
     BlockType MineGenesis(BlockType const &block) const;
     BlockType Mine(BlockType const &previous_block, BlockType const &block) const;
 
+    // Throw std::runtime_error if "session" is stopped before a valid block is found.
+    BlockType MineGenesis(BlockType const &block, MiningSession &session) const;
+    BlockType Mine(BlockType const &previous_block, BlockType const &block, MiningSession &session) const;
+
     virtual ~BlockMiner() { EMPTY_BLOCK }
   };
 
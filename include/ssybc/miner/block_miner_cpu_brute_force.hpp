@@ -22,6 +22,11 @@
 #define SSYBC_INCLUDE_SSYBC_MINER_BLOCK_MINER_CPU_BRUTE_FORCE_HPP_
 
 #include "include/ssybc/miner/block_miner.hpp"
+#include "include/ssybc/miner/mining_thread_pool.hpp"
+#include "include/ssybc/miner/mining_stats.hpp"
+#include "include/ssybc/miner/mining_throttle.hpp"
+
+#include <memory>
 
 namespace ssybc {
 
@@ -29,10 +34,37 @@ namespace ssybc {
   class BlockMinerCPUBruteForce: public virtual BlockMiner<Validator> {
   public:
 
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+    // Mines on a pool of its own with one worker per hardware thread, shared only by copies of this miner. Its workers
+    // start with the first block mined.
+    BlockMinerCPUBruteForce();
+    explicit BlockMinerCPUBruteForce(std::shared_ptr<MiningThreadPool> thread_pool_ptr);
+    // Mines in the background within the limits of "throttle".
+    BlockMinerCPUBruteForce(std::shared_ptr<MiningThreadPool> thread_pool_ptr, MiningThrottle const &throttle);
+
 // --------------------------------------------------- Public Method --------------------------------------------------
 
+    std::shared_ptr<MiningThreadPool> ThreadPoolPtr() const;
+    // Shared by copies of this miner, one worker counter per thread of ThreadPoolPtr().
+    std::shared_ptr<MiningStats> StatsPtr() const;
+    MiningThrottle Throttle() const;
+
     MinedResult MineGenesisInfo(BinaryData const &hashable_binary) const override;
     MinedResult MineInfo(BlockHash const &previous_hash, BinaryData const &hashable_binary) const override;
+    MinedResult MineGenesisInfo(BinaryData const &hashable_binary, MiningSession &session) const override;
+    MinedResult MineInfo(
+      BlockHash const &previous_hash,
+      BinaryData const &hashable_binary,
+      MiningSession &session) const override;
+
+  private:
+
+// -------------------------------------------------- Private Field ---------------------------------------------------
+
+    std::shared_ptr<MiningThreadPool> thread_pool_ptr_;
+    std::shared_ptr<MiningStats> stats_ptr_;
+    MiningThrottle throttle_;
   };
 
 
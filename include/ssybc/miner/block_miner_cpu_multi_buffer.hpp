@@ -0,0 +1,79 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_INCLUDE_SSYBC_MINER_BLOCK_MINER_CPU_MULTI_BUFFER_HPP_
+#define SSYBC_INCLUDE_SSYBC_MINER_BLOCK_MINER_CPU_MULTI_BUFFER_HPP_
+
+#include "include/ssybc/miner/block_miner.hpp"
+#include "include/ssybc/miner/mining_thread_pool.hpp"
+#include "include/ssybc/miner/mining_stats.hpp"
+#include "include/ssybc/miner/mining_throttle.hpp"
+
+#include <memory>
+
+namespace ssybc {
+
+  // Multi-thread CPU miner where every thread hashes a batch of candidate headers at once, one nonce per SIMD lane
+  // (see HashCalculatorInterface::HashBatch), and checks the difficulty target of every lane.
+  template<typename Validator>
+  class BlockMinerCPUMultiBuffer: public virtual BlockMiner<Validator> {
+  public:
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+    // Mines on a pool of its own with one worker per hardware thread, shared only by copies of this miner. Its workers
+    // start with the first block mined.
+    BlockMinerCPUMultiBuffer();
+    explicit BlockMinerCPUMultiBuffer(std::shared_ptr<MiningThreadPool> thread_pool_ptr);
+    // Mines in the background within the limits of "throttle".
+    BlockMinerCPUMultiBuffer(std::shared_ptr<MiningThreadPool> thread_pool_ptr, MiningThrottle const &throttle);
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+    std::shared_ptr<MiningThreadPool> ThreadPoolPtr() const;
+    // Shared by copies of this miner, one worker counter per thread of ThreadPoolPtr().
+    std::shared_ptr<MiningStats> StatsPtr() const;
+    MiningThrottle Throttle() const;
+
+    MinedResult MineGenesisInfo(BinaryData const &hashable_binary) const override;
+    MinedResult MineInfo(BlockHash const &previous_hash, BinaryData const &hashable_binary) const override;
+    MinedResult MineGenesisInfo(BinaryData const &hashable_binary, MiningSession &session) const override;
+    MinedResult MineInfo(
+      BlockHash const &previous_hash,
+      BinaryData const &hashable_binary,
+      MiningSession &session) const override;
+
+  private:
+
+// -------------------------------------------------- Private Field ---------------------------------------------------
+
+    std::shared_ptr<MiningThreadPool> thread_pool_ptr_;
+    std::shared_ptr<MiningStats> stats_ptr_;
+    MiningThrottle throttle_;
+  };
+
+
+}  // namespace ssybc
+
+
+#include "src/miner/block_miner_cpu_multi_buffer_impl.hpp"
+
+
+#endif  // SSYBC_INCLUDE_SSYBC_MINER_BLOCK_MINER_CPU_MULTI_BUFFER_HPP_
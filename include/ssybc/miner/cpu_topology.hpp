@@ -0,0 +1,79 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_INCLUDE_SSYBC_MINER_CPU_TOPOLOGY_HPP_
+#define SSYBC_INCLUDE_SSYBC_MINER_CPU_TOPOLOGY_HPP_
+
+#include "include/ssybc/general/general.hpp"
+
+#include <string>
+#include <vector>
+
+namespace ssybc {
+
+  struct LogicalCPU {
+  public:
+    SizeT id{};
+    SizeT core_id{};
+    SizeT package_id{};
+  };
+
+  // The logical CPUs mining workers can be placed on, with the physical core and package each belongs to, so SMT
+  // siblings can be told apart. Read from sysfs on Linux, elsewhere every logical CPU counts as its own core.
+  class CPUTopology {
+  public:
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+    explicit CPUTopology(std::vector<LogicalCPU> const &cpus);
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+    std::vector<LogicalCPU> const & LogicalCPUs() const;
+    std::vector<SizeT> CPUIds() const;
+    SizeT PhysicalCoreCount() const;
+
+    // Keeps the first logical CPU of every physical core.
+    CPUTopology WithoutSMTSiblings() const;
+    // Drops every logical CPU of the first "core_count" physical cores, in CPU id order.
+    CPUTopology WithoutFirstCores(SizeT const core_count) const;
+    CPUTopology RestrictedTo(std::vector<SizeT> const &cpu_ids) const;
+
+    // Online CPUs the calling process is allowed to run on, which honors taskset and cgroup cpusets.
+    static CPUTopology Current();
+    // Reads "online" and "cpu<N>/topology" under "cpu_directory", usually "/sys/devices/system/cpu".
+    static CPUTopology FromSysfs(std::string const &cpu_directory);
+    // Parses the kernel's CPU list format, e.g. "0-3,8,10-11".
+    static std::vector<SizeT> CPUIdsFromList(std::string const &cpu_list);
+
+  private:
+
+// -------------------------------------------------- Private Field ---------------------------------------------------
+
+    std::vector<LogicalCPU> cpus_;
+  };
+
+}  // namespace ssybc
+
+
+#include "src/miner/cpu_topology_impl.hpp"
+
+
+#endif  // SSYBC_INCLUDE_SSYBC_MINER_CPU_TOPOLOGY_HPP_
@@ -0,0 +1,134 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_INCLUDE_SSYBC_MINER_MINER_REGISTRY_HPP_
+#define SSYBC_INCLUDE_SSYBC_MINER_MINER_REGISTRY_HPP_
+
+#include "include/ssybc/general/general.hpp"
+#include "include/ssybc/miner/block_miner.hpp"
+#include "include/ssybc/miner/mining_thread_pool.hpp"
+
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ssybc {
+
+  constexpr char const * kAutoMinerName{ "auto" };
+  constexpr std::chrono::milliseconds kDefaultMinerBenchmarkDuration{ 200 };
+
+  struct MinerBenchmark {
+    std::string miner_name;
+    double hashes_per_second;
+  };
+
+  // Miners of one validator by name, so the miner of a chain can be picked at run time, e.g. from a config file.
+  // Built in are "cpu-brute-force" and "cpu-multi-buffer", and their "-single-thread" variants, every miner they make
+  // mines on a pool of its own. kAutoMinerName picks the registered miner with the highest hash
+  // rate on this machine, benchmarked on first use.
+  template<typename Validator>
+  class MinerRegistry {
+  public:
+
+// -------------------------------------------------- Type Definition -------------------------------------------------
+
+    using MinerType = BlockMiner<Validator>;
+    using MinerFactory = std::function<std::shared_ptr<MinerType>()>;
+    // Makes a miner that mines on "thread_pool_ptr".
+    using PooledMinerFactory = std::function<std::shared_ptr<MinerType>(
+      std::shared_ptr<MiningThreadPool> const &thread_pool_ptr)>;
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+    // Registers the built-in miners.
+    MinerRegistry();
+    MinerRegistry(MinerRegistry const &registry) = delete;
+    MinerRegistry(MinerRegistry &&registry) = delete;
+
+    ~MinerRegistry() = default;
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+    // Throws std::invalid_argument if "name" is empty, kAutoMinerName or already registered.
+    void Register(std::string const &name, MinerFactory const &factory);
+    // Same as above, for miners that mine on a MiningThreadPool. Create() gives every miner a pool of its own with
+    // "thread_count" workers, zero for one per hardware thread, Benchmark() a temporary one of the same size.
+    void Register(std::string const &name, SizeT const thread_count, PooledMinerFactory const &factory);
+    bool Contains(std::string const &name) const;
+    // In registration order.
+    std::vector<std::string> Names() const;
+
+    // Throws std::invalid_argument if no miner is registered as "name".
+    std::shared_ptr<MinerType> Create(std::string const &name) const;
+
+    // Mines for "duration_per_miner" with every registered miner and reports their hash rates, as counted by
+    // MiningSession::HashCount(). Miners of a PooledMinerFactory mine on a temporary pool, so no other job delays them.
+    // Miners that do not count their hashes score 0, miners that ignore the session deadline run until they find a
+    // block.
+    std::vector<MinerBenchmark> Benchmark(std::chrono::milliseconds const duration_per_miner) const;
+    std::vector<MinerBenchmark> Benchmark() const;
+
+    // Name of the miner kAutoMinerName stands for. Benchmarks on the first call and after every Register().
+    std::string FastestMinerName() const;
+
+    // Shared by every chain of this validator.
+    static MinerRegistry &Default();
+
+    MinerRegistry& operator=(MinerRegistry const &) = delete;
+    MinerRegistry& operator=(MinerRegistry &&) = delete;
+
+  private:
+
+// -------------------------------------------------- Type Definition -------------------------------------------------
+
+    // Exactly one of "factory" and "pooled_factory" is set.
+    struct Entry_ {
+      std::string name;
+      MinerFactory factory;
+      PooledMinerFactory pooled_factory;
+      SizeT thread_count;
+    };
+
+// -------------------------------------------------- Private Field ---------------------------------------------------
+
+    // Benchmarks run one at a time, without holding "mutex_".
+    mutable std::mutex benchmark_mutex_{};
+    mutable std::mutex mutex_{};
+    std::vector<Entry_> entries_{};
+    mutable std::string fastest_miner_name_{};
+
+// -------------------------------------------------- Private Method --------------------------------------------------
+
+    void Register_(Entry_ const &entry);
+    std::vector<Entry_> Entries_() const;
+    static std::shared_ptr<MiningThreadPool> NewThreadPool_(SizeT const thread_count);
+    static double HashesPerSecondOfMiner_(MinerType const &miner, std::chrono::milliseconds const duration);
+  };
+
+}  // namespace ssybc
+
+
+#include "src/miner/miner_registry_impl.hpp"
+
+
+#endif  // SSYBC_INCLUDE_SSYBC_MINER_MINER_REGISTRY_HPP_
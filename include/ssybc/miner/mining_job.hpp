@@ -0,0 +1,83 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_INCLUDE_SSYBC_MINER_MINING_JOB_HPP_
+#define SSYBC_INCLUDE_SSYBC_MINER_MINING_JOB_HPP_
+
+#include "include/ssybc/miner/mining_session.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <stdexcept>
+
+namespace ssybc {
+
+  // Handle to a block being mined on another thread, see Blockchain::MineAsync(). Cancel() stops the miner within one
+  // batch of hashes per worker. Destroying an unfinished job cancels it and waits for the miner to return.
+  // Once Get() has returned, or on a moved-from job, the job is ready, waiting returns at once and Get() throws
+  // std::runtime_error. A moved-from job is also stopped with no hashes, and Cancel() on it does nothing.
+  template<typename BlockT>
+  class MiningJob {
+  public:
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+    MiningJob(std::shared_ptr<MiningSession> const &session_ptr, std::future<BlockT> &&future);
+    MiningJob(MiningJob const &job) = delete;
+    MiningJob(MiningJob &&job) = default;
+
+    ~MiningJob();
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+    void Cancel();
+    bool IsStopped() const;
+    bool IsReady() const;
+
+    // Hashes tried so far, for progress reporting.
+    std::uint64_t HashCount() const;
+
+    void Wait() const;
+    bool WaitUntil(std::chrono::steady_clock::time_point const time_point) const;
+
+    // Blocks until the job finishes, then returns the mined block. Throws std::runtime_error if the job was cancelled
+    // or its deadline passed before a valid block was found. Can only be called once.
+    BlockT Get();
+
+    MiningJob& operator=(MiningJob const &) = delete;
+    MiningJob& operator=(MiningJob &&) = delete;
+
+  private:
+
+// -------------------------------------------------- Private Field ---------------------------------------------------
+
+    std::shared_ptr<MiningSession> session_ptr_;
+    std::future<BlockT> future_;
+  };
+
+}  // namespace ssybc
+
+
+#include "src/miner/mining_job_impl.hpp"
+
+
+#endif  // SSYBC_INCLUDE_SSYBC_MINER_MINING_JOB_HPP_
@@ -0,0 +1,108 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_INCLUDE_SSYBC_MINER_MINING_SESSION_HPP_
+#define SSYBC_INCLUDE_SSYBC_MINER_MINING_SESSION_HPP_
+
+#include "include/ssybc/miner/mined_result.hpp"
+#include "include/ssybc/miner/nonce_dispenser.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <condition_variable>
+
+namespace ssybc {
+
+  // State shared by the worker threads of one mining call. Workers poll IsStopped() in their hot loop, the first one
+  // to find a valid hash publishes it with PublishResult(), which also stops all the others. Every mining call owns
+  // its session, so independent chains can be mined concurrently in one process. A session can also be stopped from
+  // outside the miner, or given a deadline, to cancel mining. A session with a nonce range restricts the miner to that
+  // time stamp and those nonces, used to split one job among several machines.
+  class MiningSession {
+  public:
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+    MiningSession() = default;
+    explicit MiningSession(std::chrono::steady_clock::time_point const deadline);
+    explicit MiningSession(NonceBatch const &nonce_range);
+    MiningSession(NonceBatch const &nonce_range, std::chrono::steady_clock::time_point const deadline);
+    MiningSession(MiningSession const &session) = delete;
+    MiningSession(MiningSession &&session) = delete;
+
+    ~MiningSession() = default;
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+    bool IsStopped() const;
+
+    // Stops the session if its deadline has passed, then returns IsStopped(). Reads the clock, so workers call it
+    // once per nonce batch and IsStopped() once per hash.
+    bool StopIfPastDeadline();
+    std::chrono::steady_clock::time_point Deadline() const;
+
+    // Miners that honor the range stop without a result once it is exhausted.
+    bool HasNonceRange() const;
+    NonceBatch NonceRange() const;
+
+    // Number of hashes tried so far, workers report it once per nonce batch.
+    void AddHashCount(std::uint64_t const count);
+    std::uint64_t HashCount() const;
+
+    // Returns false if another worker already published a result, "result" is discarded in that case.
+    bool PublishResult(MinedResult const result);
+
+    // Stops all workers without a result.
+    void Stop();
+
+    // Blocks until a result is published or the session is stopped, stops the session if its deadline passes first.
+    void WaitUntilStopped();
+
+    bool HasResult() const;
+    MinedResult Result() const;
+
+    MiningSession& operator=(MiningSession const &) = delete;
+    MiningSession& operator=(MiningSession &&) = delete;
+
+  private:
+
+// -------------------------------------------------- Private Field ---------------------------------------------------
+
+    std::chrono::steady_clock::time_point const deadline_{ std::chrono::steady_clock::time_point::max() };
+    bool const has_nonce_range_{ false };
+    NonceBatch const nonce_range_{};
+    std::atomic<bool> is_stopped_{ false };
+    std::atomic<std::uint64_t> hash_count_{ 0 };
+    std::atomic<bool> is_result_claimed_{ false };
+    mutable std::mutex mutex_{};
+    std::condition_variable stopped_cv_{};
+    bool has_result_{ false };
+    MinedResult result_{};
+  };
+
+}  // namespace ssybc
+
+
+#include "src/miner/mining_session_impl.hpp"
+
+
+#endif  // SSYBC_INCLUDE_SSYBC_MINER_MINING_SESSION_HPP_
@@ -0,0 +1,103 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_INCLUDE_SSYBC_MINER_MINING_STATS_HPP_
+#define SSYBC_INCLUDE_SSYBC_MINER_MINING_STATS_HPP_
+
+#include "include/ssybc/general/general.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ssybc {
+
+  struct MiningStatsSnapshot {
+  public:
+    std::vector<std::uint64_t> worker_attempt_counts{};
+    std::uint64_t attempt_count{};
+    // Attempts per second of time spent mining, including the running job.
+    double hashes_per_second{};
+    std::uint64_t solved_block_count{};
+    std::chrono::nanoseconds last_time_to_solution{};
+    std::chrono::nanoseconds total_time_to_solution{};
+    std::uint64_t time_stamp_rollover_count{};
+  };
+
+  // Counters a CPU miner updates while it mines, readable from any thread through Snapshot() at any time. Everything
+  // is a relaxed atomic, every worker has its own counter on its own cache line, and workers add to it once per nonce
+  // batch, so the counters cost nothing measurable on the mining hot path.
+  class MiningStats {
+  public:
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+    explicit MiningStats(SizeT const worker_count);
+    MiningStats(MiningStats const &stats) = delete;
+    MiningStats(MiningStats &&stats) = delete;
+
+    ~MiningStats() = default;
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+    SizeT WorkerCount() const;
+    MiningStatsSnapshot Snapshot() const;
+
+    // Called by miners.
+    std::chrono::steady_clock::time_point BeginJob();
+    void EndJob(std::chrono::steady_clock::time_point const begin_time, bool const is_solved);
+    void AddAttempts(SizeT const worker_index, std::uint64_t const count);
+    void AddTimeStampRollover();
+
+    MiningStats& operator=(MiningStats const &) = delete;
+    MiningStats& operator=(MiningStats &&) = delete;
+
+  private:
+
+// -------------------------------------------------- Type Definition -------------------------------------------------
+
+    // 64 bytes apart, so no two workers write to the same cache line.
+    struct PaddedCounter_ {
+      std::atomic<std::uint64_t> value{ 0 };
+      char padding[64 - sizeof(std::atomic<std::uint64_t>)];
+    };
+
+// -------------------------------------------------- Private Field ---------------------------------------------------
+
+    SizeT const worker_count_;
+    std::unique_ptr<PaddedCounter_[]> worker_attempt_counts_;
+    std::atomic<std::uint64_t> running_job_count_{ 0 };
+    std::atomic<std::int64_t> running_job_begin_ns_{ 0 };
+    std::atomic<std::int64_t> finished_job_duration_ns_{ 0 };
+    std::atomic<std::uint64_t> solved_block_count_{ 0 };
+    std::atomic<std::int64_t> last_time_to_solution_ns_{ 0 };
+    std::atomic<std::int64_t> total_time_to_solution_ns_{ 0 };
+    std::atomic<std::uint64_t> time_stamp_rollover_count_{ 0 };
+  };
+
+}  // namespace ssybc
+
+
+#include "src/miner/mining_stats_impl.hpp"
+
+
+#endif  // SSYBC_INCLUDE_SSYBC_MINER_MINING_STATS_HPP_
@@ -0,0 +1,120 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_INCLUDE_SSYBC_MINER_MINING_THREAD_POOL_HPP_
+#define SSYBC_INCLUDE_SSYBC_MINER_MINING_THREAD_POOL_HPP_
+
+#include "include/ssybc/general/general.hpp"
+#include "include/ssybc/miner/cpu_topology.hpp"
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+
+namespace ssybc {
+
+  // Where the workers of a MiningThreadPool run. CPUs are picked from CPUTopology::Current(), so CPUs outside the
+  // process's cpuset are never used.
+  struct MiningThreadPoolConfig {
+  public:
+    // Logical CPUs workers may use, empty for all of them.
+    std::vector<SizeT> cpu_ids{};
+    // Use one logical CPU per physical core.
+    bool skips_smt_siblings{ false };
+    // Physical cores, lowest CPU ids first, left to the rest of the process, e.g. request-serving threads.
+    SizeT reserved_core_count{ 0 };
+    // Zero for one worker per selected CPU.
+    SizeT thread_count{ 0 };
+    // Pin every worker to one selected CPU, round-robin. Ignored on platforms without thread affinity.
+    bool pins_workers{ true };
+  };
+
+  // Long-lived worker threads for CPU miners, so mining a block does not create and join threads. Workers start with
+  // the first job, so a pool that never runs one holds no threads, and stay parked between jobs. A job runs on every
+  // worker at once and Run() returns when all of them have returned, jobs from different callers run one after
+  // another. Every CPU miner gets a pool of its own unless it is given one, e.g. Default(), to share with other miners.
+  class MiningThreadPool {
+  public:
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+    // One worker per hardware thread.
+    MiningThreadPool();
+    explicit MiningThreadPool(SizeT const thread_count);
+    // Throws std::invalid_argument if "config" leaves no CPU to run on.
+    explicit MiningThreadPool(MiningThreadPoolConfig const &config);
+    MiningThreadPool(MiningThreadPool const &pool) = delete;
+    MiningThreadPool(MiningThreadPool &&pool) = delete;
+
+    ~MiningThreadPool();
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+    SizeT Size() const;
+    // CPU every worker is pinned to, a worker that fails to pin logs a warning. Empty if workers are not pinned,
+    // always on platforms without thread affinity.
+    std::vector<SizeT> WorkerCPUIds() const;
+
+    // Calls "job" with the index of every worker, [0, Size()), each on its own worker. Throws std::logic_error after
+    // Shutdown(). Must not be called from inside a job of the same pool.
+    void Run(std::function<void(SizeT const worker_index)> const &job);
+
+    // Waits for the running job, if any, then joins all workers. Called by the destructor.
+    void Shutdown();
+    bool IsShutdown() const;
+
+    static std::shared_ptr<MiningThreadPool> Default();
+
+    MiningThreadPool& operator=(MiningThreadPool const &) = delete;
+    MiningThreadPool& operator=(MiningThreadPool &&) = delete;
+
+  private:
+
+// -------------------------------------------------- Private Field ---------------------------------------------------
+
+    std::mutex run_mutex_{};
+    mutable std::mutex mutex_{};
+    std::condition_variable job_cv_{};
+    std::condition_variable done_cv_{};
+    std::function<void(SizeT const)> const *job_ptr_{ nullptr };
+    SizeT job_generation_{ 0 };
+    SizeT running_worker_count_{ 0 };
+    bool is_shutdown_{ false };
+    SizeT worker_count_{ 0 };
+    std::vector<SizeT> worker_cpu_ids_{};
+    std::vector<std::thread> workers_{};
+
+// -------------------------------------------------- Private Method --------------------------------------------------
+
+    void StartWorkers_();
+    void WorkerLoop_(SizeT const worker_index);
+    static bool PinCurrentThreadToCPU_(SizeT const cpu_id);
+  };
+
+}  // namespace ssybc
+
+
+#include "src/miner/mining_thread_pool_impl.hpp"
+
+
+#endif  // SSYBC_INCLUDE_SSYBC_MINER_MINING_THREAD_POOL_HPP_
@@ -0,0 +1,81 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_INCLUDE_SSYBC_MINER_MINING_THROTTLE_HPP_
+#define SSYBC_INCLUDE_SSYBC_MINER_MINING_THROTTLE_HPP_
+
+#include "include/ssybc/general/general.hpp"
+#include "include/ssybc/miner/mining_session.hpp"
+
+#include <chrono>
+#include <cstdint>
+
+namespace ssybc {
+
+  // Nonce batch size of throttled miners, about a millisecond of hashing, so the pauses between batches are short and
+  // evenly spread.
+  constexpr BlockNonce kThrottledNonceBatchSize{ 1 << 12 };
+
+  // Limits how much of the machine a CPU miner takes. Both limits can be combined, the stricter one wins.
+  struct MiningThrottle {
+  public:
+    // Fraction of wall time every worker spends hashing, in (0, 1]. 1 for no limit.
+    double cpu_share{ 1.0 };
+    // Hashes per second across all workers, 0 for no limit.
+    double max_hashes_per_second{ 0.0 };
+
+    bool IsEnabled() const;
+  };
+
+  // Paces one worker of one mining job: the worker calls Pace() after every nonce batch, which sleeps until the time
+  // the worker has spent hashing and the hashes it has done fit the throttle again. Duty cycling per worker needs no
+  // shared state, every worker takes an equal part of the hash rate budget.
+  class MiningThrottlePacer {
+  public:
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+    MiningThrottlePacer(MiningThrottle const &throttle, SizeT const worker_count);
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+    // Returns right away if the throttle is disabled, returns early once "session" is stopped or past its deadline.
+    void Pace(std::uint64_t const hash_count, MiningSession &session);
+
+  private:
+
+// -------------------------------------------------- Private Field ---------------------------------------------------
+
+    bool const is_enabled_;
+    double const cpu_share_;
+    double const worker_hashes_per_second_;
+    std::chrono::steady_clock::time_point const start_time_;
+    std::chrono::steady_clock::time_point resume_time_;
+    std::chrono::steady_clock::duration busy_duration_{ 0 };
+    std::uint64_t hash_count_{ 0 };
+  };
+
+}  // namespace ssybc
+
+
+#include "src/miner/mining_throttle_impl.hpp"
+
+
+#endif  // SSYBC_INCLUDE_SSYBC_MINER_MINING_THROTTLE_HPP_
@@ -0,0 +1,99 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_INCLUDE_SSYBC_MINER_NONCE_DISPENSER_HPP_
+#define SSYBC_INCLUDE_SSYBC_MINER_NONCE_DISPENSER_HPP_
+
+#include "include/ssybc/general/general.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace ssybc {
+
+  constexpr BlockNonce kDefaultNonceBatchSize{ 1 << 16 };
+
+  // Nonces [nonce_start, nonce_end) to try with time_stamp.
+  struct NonceBatch {
+    BlockTimeInterval time_stamp;
+    BlockNonce nonce_start;
+    BlockNonce nonce_end;
+  };
+
+  // Hands out fixed-size nonce batches to the worker threads of one mining call, so a worker that is faster than the
+  // others simply takes more batches, and no nonce is tried twice with the same time stamp. Once every batch of the
+  // nonce space has been handed out, the next batches carry a new, strictly later time stamp.
+  // A dispenser restricted to a nonce range never changes its time stamp, once the range is used up it hands out empty
+  // batches (nonce_start == nonce_end).
+  class NonceDispenser {
+  public:
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+    NonceDispenser(BlockTimeInterval const time_stamp, BlockNonce const batch_size);
+    explicit NonceDispenser(BlockTimeInterval const time_stamp);
+    NonceDispenser(NonceBatch const &nonce_range, BlockNonce const batch_size);
+    NonceDispenser(NonceDispenser const &dispenser) = delete;
+    NonceDispenser(NonceDispenser &&dispenser) = delete;
+
+    ~NonceDispenser() = default;
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+    BlockNonce BatchSize() const;
+
+    // Thread-safe, lock-free unless the batch starts a new time stamp.
+    NonceBatch NextBatch();
+
+    NonceDispenser& operator=(NonceDispenser const &) = delete;
+    NonceDispenser& operator=(NonceDispenser &&) = delete;
+
+  private:
+
+// -------------------------------------------------- Private Field ---------------------------------------------------
+
+    BlockNonce const batch_size_;
+    BlockNonce const nonce_start_;
+    BlockNonce const nonce_end_;
+    BlockNonce const batch_count_per_time_stamp_;
+    BlockTimeInterval const first_time_stamp_;
+    bool const rolls_over_time_stamp_;
+    std::atomic<BlockNonce> next_batch_index_{ 0 };
+    std::mutex time_stamps_mutex_{};
+    std::vector<BlockTimeInterval> time_stamps_{};
+
+// -------------------------------------------------- Private Method --------------------------------------------------
+
+    NonceDispenser(
+      NonceBatch const &nonce_range,
+      BlockNonce const batch_size,
+      bool const rolls_over_time_stamp);
+
+    BlockTimeInterval TimeStampOfRound_(BlockNonce const round);
+  };
+
+}  // namespace ssybc
+
+
+#include "src/miner/nonce_dispenser_impl.hpp"
+
+
+#endif  // SSYBC_INCLUDE_SSYBC_MINER_NONCE_DISPENSER_HPP_
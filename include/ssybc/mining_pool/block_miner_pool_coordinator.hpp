@@ -0,0 +1,78 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_INCLUDE_SSYBC_MINING_POOL_BLOCK_MINER_POOL_COORDINATOR_HPP_
+#define SSYBC_INCLUDE_SSYBC_MINING_POOL_BLOCK_MINER_POOL_COORDINATOR_HPP_
+
+#include "include/ssybc/miner/block_miner.hpp"
+#include "include/ssybc/mining_pool/mining_pool_coordinator.hpp"
+
+#include <memory>
+#include <string>
+
+namespace ssybc {
+
+  // Mines blocks on the workers of a mining pool, see MiningPoolCoordinator. Every result is checked with Validator
+  // before it is accepted. Copies of this miner share one coordinator.
+  template<typename Validator>
+  class BlockMinerPoolCoordinator: public virtual BlockMiner<Validator> {
+  public:
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+    // Throws std::runtime_error if "address" cannot be listened on.
+    explicit BlockMinerPoolCoordinator(std::string const &address);
+    explicit BlockMinerPoolCoordinator(std::shared_ptr<MiningPoolCoordinator> coordinator_ptr);
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+    std::shared_ptr<MiningPoolCoordinator> CoordinatorPtr() const;
+
+    MinedResult MineGenesisInfo(BinaryData const &hashable_binary) const override;
+    MinedResult MineInfo(BlockHash const &previous_hash, BinaryData const &hashable_binary) const override;
+    MinedResult MineGenesisInfo(BinaryData const &hashable_binary, MiningSession &session) const override;
+    MinedResult MineInfo(
+      BlockHash const &previous_hash,
+      BinaryData const &hashable_binary,
+      MiningSession &session) const override;
+
+  private:
+
+// -------------------------------------------------- Private Field ---------------------------------------------------
+
+    std::shared_ptr<MiningPoolCoordinator> coordinator_ptr_;
+
+// -------------------------------------------------- Private Method --------------------------------------------------
+
+    MinedResult MineOnPool_(
+      bool const is_genesis,
+      BlockHash const &previous_hash,
+      BinaryData const &hashable_binary,
+      MiningSession &session) const;
+  };
+
+
+}  // namespace ssybc
+
+
+#include "src/mining_pool/block_miner_pool_coordinator_impl.hpp"
+
+
+#endif  // SSYBC_INCLUDE_SSYBC_MINING_POOL_BLOCK_MINER_POOL_COORDINATOR_HPP_
@@ -0,0 +1,128 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_INCLUDE_SSYBC_MINING_POOL_MINING_POOL_CONNECTION_HPP_
+#define SSYBC_INCLUDE_SSYBC_MINING_POOL_MINING_POOL_CONNECTION_HPP_
+
+#include "include/ssybc/general/general.hpp"
+#include "include/ssybc/mining_pool/mining_pool_protocol.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace ssybc {
+
+  // Mining pool addresses are "tcp://<host>:<port>" or "unix://<socket path>", e.g. "tcp://127.0.0.1:8333" or
+  // "unix:///tmp/ssybc_pool.sock". A listener given port 0 picks a free port, see MiningPoolListener::Address().
+
+  // A connected stream socket that carries mining pool messages. Send() may be called from any thread, Receive() from
+  // one thread at a time.
+  class MiningPoolConnection {
+  public:
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+    // Takes ownership of "socket_fd".
+    explicit MiningPoolConnection(int const socket_fd);
+    MiningPoolConnection(MiningPoolConnection const &connection) = delete;
+    MiningPoolConnection(MiningPoolConnection &&connection) = delete;
+
+    ~MiningPoolConnection();
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+    // Throws std::runtime_error if "address" is malformed or cannot be connected to.
+    static std::shared_ptr<MiningPoolConnection> Connect(std::string const &address);
+
+    // Throws std::runtime_error if the connection is closed or broken.
+    void Send(MiningPoolMessageType const type, BinaryData const &payload);
+
+    // Blocks until a whole message arrives. Returns false once the peer closes the connection or Shutdown() is
+    // called, throws std::runtime_error on a malformed frame.
+    bool Receive(MiningPoolMessage &message);
+
+    // Unblocks Receive() and fails later Send() calls, on both ends.
+    void Shutdown();
+    bool IsShutdown() const;
+
+    MiningPoolConnection& operator=(MiningPoolConnection const &) = delete;
+    MiningPoolConnection& operator=(MiningPoolConnection &&) = delete;
+
+  private:
+
+// -------------------------------------------------- Private Field ---------------------------------------------------
+
+    int const socket_fd_;
+    std::atomic<bool> is_shutdown_{ false };
+    std::mutex send_mutex_{};
+
+// -------------------------------------------------- Private Method --------------------------------------------------
+
+    bool ReceiveBytes_(Byte * const bytes, SizeT const size);
+  };
+
+  // A listening socket that accepts mining pool workers.
+  class MiningPoolListener {
+  public:
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+    // Throws std::runtime_error if "address" is malformed or cannot be listened on. A stale socket file at a unix
+    // address is replaced.
+    explicit MiningPoolListener(std::string const &address);
+    MiningPoolListener(MiningPoolListener const &listener) = delete;
+    MiningPoolListener(MiningPoolListener &&listener) = delete;
+
+    ~MiningPoolListener();
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+    // Address workers connect to, with the actual port if the listener was given port 0.
+    std::string Address() const;
+
+    // Blocks until a worker connects, returns nullptr once Close() is called.
+    std::shared_ptr<MiningPoolConnection> Accept();
+
+    // Unblocks Accept(), and removes the socket file of a unix address. Called by the destructor.
+    void Close();
+
+    MiningPoolListener& operator=(MiningPoolListener const &) = delete;
+    MiningPoolListener& operator=(MiningPoolListener &&) = delete;
+
+  private:
+
+// -------------------------------------------------- Private Field ---------------------------------------------------
+
+    int socket_fd_{ -1 };
+    std::string address_{};
+    std::string unix_socket_path_{};
+    std::atomic<bool> is_closed_{ false };
+    std::mutex close_mutex_{};
+  };
+
+}  // namespace ssybc
+
+
+#include "src/mining_pool/mining_pool_connection_impl.hpp"
+
+
+#endif  // SSYBC_INCLUDE_SSYBC_MINING_POOL_MINING_POOL_CONNECTION_HPP_
@@ -0,0 +1,129 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_INCLUDE_SSYBC_MINING_POOL_MINING_POOL_COORDINATOR_HPP_
+#define SSYBC_INCLUDE_SSYBC_MINING_POOL_MINING_POOL_COORDINATOR_HPP_
+
+#include "include/ssybc/general/general.hpp"
+#include "include/ssybc/miner/mined_result.hpp"
+#include "include/ssybc/miner/mining_session.hpp"
+#include "include/ssybc/miner/nonce_dispenser.hpp"
+#include "include/ssybc/mining_pool/mining_pool_connection.hpp"
+
+#include <atomic>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+
+namespace ssybc {
+
+  // Server side of a mining pool. Workers connect at any time, a job is serialized once, then every worker is
+  // assigned its own nonce range of it and asks for the next range once it has tried them all. Solutions are verified
+  // here before they are accepted, a worker is trusted with nothing but its hash rate, and may not pick its own time
+  // stamp. Jobs run one at a time, workers
+  // connected to a coordinator must mine with the same validator as its caller.
+  class MiningPoolCoordinator {
+  public:
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+    // Throws std::runtime_error if "address" cannot be listened on.
+    explicit MiningPoolCoordinator(std::string const &address);
+    MiningPoolCoordinator(std::string const &address, BlockNonce const nonce_range_size);
+    MiningPoolCoordinator(MiningPoolCoordinator const &coordinator) = delete;
+    MiningPoolCoordinator(MiningPoolCoordinator &&coordinator) = delete;
+
+    ~MiningPoolCoordinator();
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+    std::string Address() const;
+    BlockNonce NonceRangeSize() const;
+    SizeT WorkerCount() const;
+
+    // Has the connected workers mine "hashable_binary" until one of them finds a result that passes
+    // "is_valid_result", which is published to "session", or until "session" is stopped. Waits for workers if none
+    // is connected. Jobs from different callers run one after another. Throws std::logic_error after Shutdown().
+    MinedResult Mine(
+      bool const is_genesis,
+      BlockHash const &previous_hash,
+      BinaryData const &hashable_binary,
+      std::function<bool(MinedResult const &)> const &is_valid_result,
+      MiningSession &session);
+
+    // Stops the running job, if any, disconnects all workers and stops listening. Called by the destructor.
+    void Shutdown();
+    bool IsShutdown() const;
+
+    MiningPoolCoordinator& operator=(MiningPoolCoordinator const &) = delete;
+    MiningPoolCoordinator& operator=(MiningPoolCoordinator &&) = delete;
+
+  private:
+
+// -------------------------------------------------- Type Definition -------------------------------------------------
+
+    struct Worker_ {
+      std::shared_ptr<MiningPoolConnection> connection_ptr;
+      std::thread thread{};
+      std::atomic<bool> has_finished{ false };
+    };
+
+// -------------------------------------------------- Private Field ---------------------------------------------------
+
+    BlockNonce const nonce_range_size_;
+    MiningPoolListener listener_;
+    std::thread accept_thread_{};
+    std::mutex job_mutex_{};
+
+    // Guards everything below.
+    mutable std::mutex mutex_{};
+    bool is_shutdown_{ false };
+    std::list<std::unique_ptr<Worker_>> worker_ptrs_{};
+    bool has_job_{ false };
+    std::uint64_t job_id_{ 0 };
+    BinaryData job_template_payload_{};
+    std::unique_ptr<NonceDispenser> job_dispenser_ptr_{};
+    // Time stamps of the nonce ranges handed out for the job, a solution must use one of them.
+    std::set<BlockTimeInterval> job_time_stamps_{};
+    MiningSession *job_session_ptr_{ nullptr };
+    std::function<bool(MinedResult const &)> job_is_valid_result_{};
+
+// -------------------------------------------------- Private Method --------------------------------------------------
+
+    void AcceptWorkers_();
+    void ServeWorker_(Worker_ &worker);
+
+    // Must hold "mutex_".
+    void SendNextNonceRange_(MiningPoolConnection &connection);
+    void HandleSolution_(MiningPoolSolution const &solution);
+    void JoinFinishedWorkers_();
+  };
+
+}  // namespace ssybc
+
+
+#include "src/mining_pool/mining_pool_coordinator_impl.hpp"
+
+
+#endif  // SSYBC_INCLUDE_SSYBC_MINING_POOL_MINING_POOL_COORDINATOR_HPP_
@@ -0,0 +1,92 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_INCLUDE_SSYBC_MINING_POOL_MINING_POOL_PROTOCOL_HPP_
+#define SSYBC_INCLUDE_SSYBC_MINING_POOL_MINING_POOL_PROTOCOL_HPP_
+
+#include "include/ssybc/general/general.hpp"
+#include "include/ssybc/miner/mined_result.hpp"
+#include "include/ssybc/miner/nonce_dispenser.hpp"
+
+#include <cstdint>
+
+namespace ssybc {
+
+  // Messages between a MiningPoolCoordinator and its MiningPoolWorkers. On the wire every message is a 1 byte type,
+  // a 4 byte payload size and the payload, all integers little-endian.
+  //
+  //   kJob          coordinator -> worker  job id, genesis flag, previous hash, header template, nonce range
+  //   kWorkRequest  worker -> coordinator  job id, sent once the worker has exhausted its nonce range
+  //   kSolution     worker -> coordinator  job id, time stamp, nonce
+  //   kStopJob      coordinator -> worker  job id, the job is solved or cancelled
+  enum class MiningPoolMessageType: Byte {
+    kJob = 1,
+    kWorkRequest = 2,
+    kSolution = 3,
+    kStopJob = 4
+  };
+
+  constexpr std::uint32_t kMiningPoolMaxPayloadSize{ kNumberOfBytesInMB };
+  constexpr BlockNonce kDefaultMiningPoolNonceRangeSize{ BlockNonce{ 1 } << 28 };
+
+  struct MiningPoolMessage {
+    MiningPoolMessageType type;
+    BinaryData payload;
+  };
+
+  // A header template to mine and the part of its nonce space assigned to one worker.
+  struct MiningPoolJob {
+    std::uint64_t job_id;
+    bool is_genesis;
+    BlockHash previous_hash;
+    BinaryData hashable_binary;
+    NonceBatch nonce_range;
+  };
+
+  struct MiningPoolSolution {
+    std::uint64_t job_id;
+    MinedResult result;
+  };
+
+// -------------------------------------------------- Public Function -------------------------------------------------
+
+  // A job is encoded as its template followed by its nonce range, so the coordinator serializes the header template
+  // once per job and only appends a range per assignment.
+  BinaryData MiningPoolJobTemplatePayload(
+    std::uint64_t const job_id,
+    bool const is_genesis,
+    BlockHash const &previous_hash,
+    BinaryData const &hashable_binary);
+  BinaryData MiningPoolJobPayload(BinaryData const &job_template_payload, NonceBatch const &nonce_range);
+  BinaryData MiningPoolSolutionPayload(MiningPoolSolution const &solution);
+  BinaryData MiningPoolJobIdPayload(std::uint64_t const job_id);
+
+  // Throw std::runtime_error if "payload" is malformed.
+  MiningPoolJob MiningPoolJobFromPayload(BinaryData const &payload);
+  MiningPoolSolution MiningPoolSolutionFromPayload(BinaryData const &payload);
+  std::uint64_t MiningPoolJobIdFromPayload(BinaryData const &payload);
+
+}  // namespace ssybc
+
+
+#include "src/mining_pool/mining_pool_protocol_impl.hpp"
+
+
+#endif  // SSYBC_INCLUDE_SSYBC_MINING_POOL_MINING_POOL_PROTOCOL_HPP_
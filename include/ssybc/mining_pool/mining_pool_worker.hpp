@@ -0,0 +1,102 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_INCLUDE_SSYBC_MINING_POOL_MINING_POOL_WORKER_HPP_
+#define SSYBC_INCLUDE_SSYBC_MINING_POOL_MINING_POOL_WORKER_HPP_
+
+#include "include/ssybc/general/general.hpp"
+#include "include/ssybc/miner/block_miner.hpp"
+#include "include/ssybc/miner/mining_session.hpp"
+#include "include/ssybc/mining_pool/mining_pool_connection.hpp"
+#include "include/ssybc/mining_pool/mining_pool_protocol.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace ssybc {
+
+  // Client side of a mining pool, see MiningPoolCoordinator. Mines the nonce ranges it is assigned with a local
+  // miner, which should honor the nonce range of its MiningSession the way the CPU miners do, and reports solutions
+  // to the coordinator. Validator must be the one the coordinator checks solutions with.
+  template<typename Validator>
+  class MiningPoolWorker {
+  public:
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+    // Mines with BlockMinerCPUBruteForce on a pool of its own.
+    explicit MiningPoolWorker(std::string const &address);
+    MiningPoolWorker(std::string const &address, std::shared_ptr<BlockMiner<Validator>> miner_ptr);
+    MiningPoolWorker(MiningPoolWorker const &worker) = delete;
+    MiningPoolWorker(MiningPoolWorker &&worker) = delete;
+
+    ~MiningPoolWorker();
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+    // Connects to the coordinator and mines its jobs until the coordinator disconnects or Stop() is called. Throws
+    // std::runtime_error if the coordinator cannot be reached.
+    void Run();
+
+    // Makes Run() return, from any thread.
+    void Stop();
+
+    // Solutions sent to the coordinator, accepted or not.
+    SizeT SolutionCount() const;
+
+    MiningPoolWorker& operator=(MiningPoolWorker const &) = delete;
+    MiningPoolWorker& operator=(MiningPoolWorker &&) = delete;
+
+  private:
+
+// -------------------------------------------------- Private Field ---------------------------------------------------
+
+    std::string const address_;
+    std::shared_ptr<BlockMiner<Validator>> const miner_ptr_;
+    std::atomic<SizeT> solution_count_{ 0 };
+
+    // Guards everything below.
+    std::mutex mutex_{};
+    bool is_stopped_{ false };
+    std::shared_ptr<MiningPoolConnection> connection_ptr_{};
+    std::shared_ptr<MiningSession> session_ptr_{};
+    std::uint64_t session_job_id_{ 0 };
+    std::thread mining_thread_{};
+
+// -------------------------------------------------- Private Method --------------------------------------------------
+
+    void StartMining_(MiningPoolJob const &job);
+    void StopMining_();
+    void MineNonceRange_(
+      std::shared_ptr<MiningPoolConnection> const connection_ptr,
+      std::shared_ptr<MiningSession> const session_ptr,
+      MiningPoolJob const job);
+  };
+
+}  // namespace ssybc
+
+
+#include "src/mining_pool/mining_pool_worker_impl.hpp"
+
+
+#endif  // SSYBC_INCLUDE_SSYBC_MINING_POOL_MINING_POOL_WORKER_HPP_
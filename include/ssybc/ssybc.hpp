@@ -26,7 +26,6 @@
 #include "include/ssybc/logging/logging.hpp"
 
 #include "include/ssybc/utility/utility.hpp"
-#include "include/ssybc/utility/operator.hpp"
 
 #include "include/ssybc/binary_data_converter/binary_data_converter_interface.hpp"
 #include "include/ssybc/binary_data_converter/binary_data_converter_default.hpp"
@@ -34,6 +33,7 @@
 #include "include/ssybc/hash_calculator/hash_calculator_interface.hpp"
 #include "include/ssybc/hash_calculator/hash_calculator_sha256.hpp"
 #include "include/ssybc/hash_calculator/hash_calculator_double_sha256.hpp"
+#include "include/ssybc/hash_calculator/hash_calculator_sha256_midstate.hpp"
 
 #include "include/ssybc/block/block.hpp"
 #include "include/ssybc/block/block_header/block_header.hpp"
@@ -41,12 +41,31 @@
 
 #include "include/ssybc/validator/block_validator.hpp"
 #include "include/ssybc/validator/block_validator_less_hash.hpp"
+#include "include/ssybc/validator/block_validator_leading_zero_bits.hpp"
 
 #include "include/ssybc/blockchain/blockchain.hpp"
 #include "include/ssybc/blockchain/blockchain_iterator/blockchain_iterator.hpp"
 
 #include "include/ssybc/miner/block_miner.hpp"
+#include "include/ssybc/miner/mined_result.hpp"
+#include "include/ssybc/miner/mining_session.hpp"
+#include "include/ssybc/miner/mining_job.hpp"
+#include "include/ssybc/miner/cpu_topology.hpp"
+#include "include/ssybc/miner/mining_thread_pool.hpp"
+#include "include/ssybc/miner/mining_stats.hpp"
+#include "include/ssybc/miner/mining_throttle.hpp"
+#include "include/ssybc/miner/nonce_dispenser.hpp"
 #include "include/ssybc/miner/block_miner_cpu_brute_force.hpp"
+#include "include/ssybc/miner/block_miner_cpu_multi_buffer.hpp"
+#include "include/ssybc/miner/miner_registry.hpp"
+
+#ifdef SSYBC_HAS_POSIX_SOCKETS
+#include "include/ssybc/mining_pool/mining_pool_protocol.hpp"
+#include "include/ssybc/mining_pool/mining_pool_connection.hpp"
+#include "include/ssybc/mining_pool/mining_pool_coordinator.hpp"
+#include "include/ssybc/mining_pool/block_miner_pool_coordinator.hpp"
+#include "include/ssybc/mining_pool/mining_pool_worker.hpp"
+#endif  // SSYBC_HAS_POSIX_SOCKETS
 
 #endif  // SSYBC_INCLUDE_SSYBC_SSYBC_HPP
 
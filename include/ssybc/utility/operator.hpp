@@ -21,26 +21,9 @@
 #ifndef SSYBC_INCLUDE_SSYBC_UTILITY_OPERATOR_HPP_
 #define SSYBC_INCLUDE_SSYBC_UTILITY_OPERATOR_HPP_
 
-#include "include/ssybc/general/general.hpp"
-
-namespace ssybc {
-
-namespace util {
-
-  
-// -------------------------------------------------- Public Function -------------------------------------------------
-
-  bool operator!=(BlockHash const &lhs, BlockHash const &rhs);
-  bool operator==(BlockHash const &lhs, BlockHash const &rhs);
-  bool operator<=(BlockHash const &lhs, BlockHash const &rhs);
-  bool operator>=(BlockHash const &lhs, BlockHash const &rhs);
-  bool operator<(BlockHash const &lhs, BlockHash const &rhs);
-  bool operator>(BlockHash const &lhs, BlockHash const &rhs);
-
-}  // namespace util
-
-}  // namespace ssybc
+// Kept so existing includes still compile. The util::operator<, <=, > and >= on BlockHash are gone, compare hashes
+// with the member operators of BlockHash instead, e.g. "lhs < rhs".
+#include "include/ssybc/general/block_hash.hpp"
 
 
 #endif  // SSYBC_INCLUDE_SSYBC_UTILITY_OPERATOR_HPP_
-
@@ -49,14 +49,23 @@ namespace util {
   std::string BinaryStringFromBytes(BinaryData const &bytes, std::string const delimiter);
   std::string HexStringFromBytes(BinaryData const &bytes);
   std::string HexStringFromBytes(BinaryData const &bytes, std::string const delimiter);
+  std::string HexStringFromBytes(BlockHash const &hash);
+  std::string HexStringFromBytes(BlockHash const &hash, std::string const delimiter);
+  BinaryData BytesFromHexString(std::string const &hex_string);
 
-  BlockHash HashStrippedLeadingZeros(BlockHash const &hash);
+  BinaryData HashStrippedLeadingZeros(BlockHash const &hash);
 
   BlockTimeInterval TrailingTimeStampBeforeNonceFromBinaryData(BinaryData const &binary_data);
   BlockNonce TrailingNonceFromBinaryData(BinaryData const &binary_data);
 
   void UpdateBinaryDataWithTrailingTimeStampBeforeNonce(BinaryData &binary_data, BlockTimeInterval const time_stamp);
   void UpdateBinaryDataWithTrailingNonce(BinaryData &binary_data, BlockNonce const nonce);
+  // Same as above, on the "size" bytes starting at "bytes".
+  void UpdateBytesWithTrailingTimeStampBeforeNonce(
+    Byte * const bytes,
+    SizeT const size,
+    BlockTimeInterval const time_stamp);
+  void UpdateBytesWithTrailingNonce(Byte * const bytes, SizeT const size, BlockNonce const nonce);
 
   template<typename T>
   T ByteSwap(T const value);
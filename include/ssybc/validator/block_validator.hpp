@@ -22,9 +22,17 @@
 #define SSYBC_INCLUDE_SSYBC_VALIDATOR_BLOCK_VALIDATOR_HPP_
 
 #include "include/ssybc/general/general.hpp"
+#include "include/ssybc/miner/mining_thread_pool.hpp"
+#include "include/ssybc/validator/validation_cache.hpp"
+
+#include <memory>
+#include <vector>
 
 namespace ssybc {
 
+  // Headers a worker hashes at once when validating a batch of blocks.
+  constexpr SizeT kBatchValidationChunkSize{ 64 };
+
   template<typename BlockT, HashDifficulty Difficulty>
   class BlockValidator {
   public:
@@ -32,6 +40,7 @@ namespace ssybc {
 // --------------------------------------------------- Public Method --------------------------------------------------
 
     using BlockType = BlockT;
+    using BlockHeaderType = typename BlockT::BlockHeaderType;
 
     virtual bool IsValidGenesisBlockHash(BlockHash const &hash) const = 0;
     virtual bool IsValidHashToAppend(BlockHash const &previous_hash, BlockHash const &hash) const = 0;
@@ -40,7 +49,61 @@ namespace ssybc {
     bool IsValidGenesisBlock(BlockT const &block) const;
     bool IsValidToAppend(BlockT const &previous_block, BlockT const &block) const;
 
+    // Verdicts on headers are looked up in "cache_ptr" first and recorded to it, no cache if null. On a miss the header
+    // is hashed again, so a recorded verdict never depends on a stored hash. Verdicts are recorded under the type of
+    // this validator, a cache can be shared with validators of other types and difficulties.
+    void SetValidationCachePtr(std::shared_ptr<ValidationCache<BlockHeaderType>> const &cache_ptr);
+    std::shared_ptr<ValidationCache<BlockHeaderType>> ValidationCachePtr() const;
+
+    // Index of the first of "blocks", a run of BlockT or BlockHeaderType, that is not valid to append to the one
+    // before it, or blocks.size() if all of them are. The first one is checked as the genesis block, or against
+    // "previous_block". Every header is hashed again in batches, stored hashes are only compared with the result.
+    template<typename BlockOrHeaderT>
+    SizeT FirstInvalidIndex(std::vector<BlockOrHeaderT> const &blocks) const;
+    template<typename BlockOrHeaderT>
+    SizeT FirstInvalidIndex(BlockOrHeaderT const &previous_block, std::vector<BlockOrHeaderT> const &blocks) const;
+    // Same as above, hashing on all workers of "thread_pool".
+    template<typename BlockOrHeaderT>
+    SizeT FirstInvalidIndex(std::vector<BlockOrHeaderT> const &blocks, MiningThreadPool &thread_pool) const;
+    template<typename BlockOrHeaderT>
+    SizeT FirstInvalidIndex(
+      BlockOrHeaderT const &previous_block,
+      std::vector<BlockOrHeaderT> const &blocks,
+      MiningThreadPool &thread_pool) const;
+
     virtual ~BlockValidator() { EMPTY_BLOCK }
+
+  private:
+
+// -------------------------------------------------- Private Field ---------------------------------------------------
+
+    std::shared_ptr<ValidationCache<BlockHeaderType>> validation_cache_ptr_{};
+
+// -------------------------------------------------- Private Method --------------------------------------------------
+
+    // Whether "header" hashes to "hash" and to its stored hash, and meets the proof of work against its own previous
+    // hash. This is the verdict kept in a ValidationCache.
+    bool IsValidHeader_(BlockHeaderType const &header, BlockHash const &hash) const;
+    // Same as above, looked up in the cache, or recorded to it after hashing "header" again.
+    bool IsValidHeaderCached_(BlockHeaderType const &header) const;
+    static bool IsHeaderPreAdjacentTo_(BlockHeaderType const &lhs, BlockHeaderType const &rhs);
+    template<typename BlockOrHeaderT>
+    SizeT FirstInvalidIndex_(
+      BlockHeaderType const *previous_header_ptr,
+      std::vector<BlockOrHeaderT> const &blocks,
+      MiningThreadPool *thread_pool_ptr) const;
+    // Hashes the headers of blocks[indices[begin]] to blocks[indices[end - 1]] into hashes[begin] to
+    // hashes[end - 1], serialized into "buffer".
+    template<typename BlockOrHeaderT>
+    static void HashHeaders_(
+      std::vector<BlockOrHeaderT> const &blocks,
+      std::vector<SizeT> const &indices,
+      SizeT const begin,
+      SizeT const end,
+      BinaryData &buffer,
+      BlockHash * const hashes);
+    static BlockHeaderType const &HeaderOf_(BlockT const &block);
+    static BlockHeaderType const &HeaderOf_(BlockHeaderType const &header);
   };
 
 }  // namespace ssybc
@@ -31,16 +31,13 @@ namespace ssybc {
 
 // --------------------------------------------------- Public Method --------------------------------------------------
 
-    BlockValidatorLessHash();
+    BlockValidatorLessHash() = default;
 
+    // A genesis hash is valid if its first "Difficulty" bytes are zero, checked without a runtime loop.
     bool IsValidGenesisBlockHash(BlockHash const &hash) const override final;
     bool IsValidHashToAppend(BlockHash const &previous_hash, BlockHash const &hash) const override final;
 
-  private:
-
-// --------------------------------------------------- Private Member -------------------------------------------------
-    
-    BlockHash max_hash_{};
+    static_assert(Difficulty <= kSizeOfBlockHashInBytes, "Difficulty cannot exceed the number of bytes in a hash.");
   };
 
 }  // namespace ssybc
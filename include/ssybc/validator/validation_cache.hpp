@@ -0,0 +1,125 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_INCLUDE_SSYBC_VALIDATOR_VALIDATION_CACHE_HPP_
+#define SSYBC_INCLUDE_SSYBC_VALIDATOR_VALIDATION_CACHE_HPP_
+
+#include "include/ssybc/general/general.hpp"
+
+#include <array>
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <typeindex>
+#include <unordered_map>
+
+namespace ssybc {
+
+  constexpr SizeT kDefaultValidationCacheCapacityInBytes{ 16 * kNumberOfBytesInMB };
+  // Independently locked parts of a ValidationCache, so validators on different threads rarely wait for each other.
+  constexpr SizeT kValidationCacheShardCount{ 16 };
+
+  // Bounded verdicts of block validators, keyed by header hash and validator type, that any number of validators and
+  // threads can share. A verdict says whether a header hashes to its hash and meets the proof of work of the validator
+  // against its own previous hash, so it holds wherever the header is presented again to a validator of the same type.
+  // The type includes the difficulty, so validators of different difficulties never see each other's verdicts.
+  // Headers are kept with their verdicts and a lookup only hits for an identical header. The oldest verdicts of a
+  // shard are evicted first once it is full.
+  template<typename BlockHeaderT>
+  class ValidationCache {
+  public:
+
+// -------------------------------------------------- Type Definition -------------------------------------------------
+
+    using BlockHeaderType = BlockHeaderT;
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+    ValidationCache();
+    // Holds as many verdicts as fit in about "capacity_in_bytes", at least one per shard.
+    explicit ValidationCache(SizeT const capacity_in_bytes);
+    ValidationCache(ValidationCache const &cache) = delete;
+    ValidationCache(ValidationCache &&cache) = delete;
+
+    ~ValidationCache() = default;
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+    // Sets "is_valid" and returns true if there is a verdict for "header" by a validator of type "validator_type".
+    bool Lookup(std::type_index const &validator_type, BlockHeaderT const &header, bool &is_valid) const;
+    void Insert(std::type_index const &validator_type, BlockHeaderT const &header, bool const is_valid);
+    void Clear();
+
+    SizeT Size() const;
+    SizeT Capacity() const;
+    SizeT HitCount() const;
+    SizeT MissCount() const;
+
+    // Approximate memory held by one verdict.
+    static SizeT SizeOfEntry();
+
+    ValidationCache& operator=(ValidationCache const &) = delete;
+    ValidationCache& operator=(ValidationCache &&) = delete;
+
+  private:
+
+// -------------------------------------------------- Type Definition -------------------------------------------------
+
+    struct Key_ {
+      BlockHash header_hash;
+      std::type_index validator_type;
+
+      bool operator==(Key_ const &key) const;
+    };
+
+    struct KeyHasher_ {
+      std::size_t operator()(Key_ const &key) const;
+    };
+
+    struct Entry_ {
+      BlockHeaderT header;
+      bool is_valid;
+    };
+
+    struct Shard_ {
+      mutable std::mutex mutex{};
+      std::unordered_map<Key_, Entry_, KeyHasher_> entry_dict{};
+      std::deque<Key_> insertion_order{};
+    };
+
+// -------------------------------------------------- Private Field ---------------------------------------------------
+
+    SizeT const shard_capacity_;
+    mutable std::array<Shard_, kValidationCacheShardCount> shards_{};
+    mutable std::atomic<SizeT> hit_count_{ 0 };
+    mutable std::atomic<SizeT> miss_count_{ 0 };
+
+// -------------------------------------------------- Private Method --------------------------------------------------
+
+    Shard_ &ShardOf_(BlockHash const &hash) const;
+  };
+
+}  // namespace ssybc
+
+
+#include "src/validator/validation_cache_impl.hpp"
+
+
+#endif  // SSYBC_INCLUDE_SSYBC_VALIDATOR_VALIDATION_CACHE_HPP_
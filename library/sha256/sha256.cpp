@@ -15,7 +15,7 @@
 
 /*************************** HEADER FILES ***************************/
 #include <memory.h>
-#include "library/sha256/sha256.hpp"
+#include "library/sha256/sha256_internal.hpp"
 
 /****************************** MACROS ******************************/
 #define ROTLEFT(a,b) (((a) << (b)) | ((a) >> (32-(b))))
@@ -28,58 +28,53 @@
 #define SIG0(x) (ROTRIGHT(x,7) ^ ROTRIGHT(x,18) ^ ((x) >> 3))
 #define SIG1(x) (ROTRIGHT(x,17) ^ ROTRIGHT(x,19) ^ ((x) >> 10))
 
-/**************************** VARIABLES *****************************/
-static const WORD k[64] = {
-	0x428a2f98,0x71374491,0xb5c0fbcf,0xe9b5dba5,0x3956c25b,0x59f111f1,0x923f82a4,0xab1c5ed5,
-	0xd807aa98,0x12835b01,0x243185be,0x550c7dc3,0x72be5d74,0x80deb1fe,0x9bdc06a7,0xc19bf174,
-	0xe49b69c1,0xefbe4786,0x0fc19dc6,0x240ca1cc,0x2de92c6f,0x4a7484aa,0x5cb0a9dc,0x76f988da,
-	0x983e5152,0xa831c66d,0xb00327c8,0xbf597fc7,0xc6e00bf3,0xd5a79147,0x06ca6351,0x14292967,
-	0x27b70a85,0x2e1b2138,0x4d2c6dfc,0x53380d13,0x650a7354,0x766a0abb,0x81c2c92e,0x92722c85,
-	0xa2bfe8a1,0xa81a664b,0xc24b8b70,0xc76c51a3,0xd192e819,0xd6990624,0xf40e3585,0x106aa070,
-	0x19a4c116,0x1e376c08,0x2748774c,0x34b0bcb5,0x391c0cb3,0x4ed8aa4a,0x5b9cca4f,0x682e6ff3,
-	0x748f82ee,0x78a5636f,0x84c87814,0x8cc70208,0x90befffa,0xa4506ceb,0xbef9a3f7,0xc67178f2
-};
-
 /*********************** FUNCTION DEFINITIONS ***********************/
-void sha256_transform(SHA256_CTX *ctx, const BYTE data[])
+void sha256_compress_generic(WORD state[8], const BYTE data[], size_t blocks)
 {
 	WORD a, b, c, d, e, f, g, h, i, j, t1, t2, m[64];
 
-	for (i = 0, j = 0; i < 16; ++i, j += 4)
-		m[i] = (data[j] << 24) | (data[j + 1] << 16) | (data[j + 2] << 8) | (data[j + 3]);
-	for ( ; i < 64; ++i)
-		m[i] = SIG1(m[i - 2]) + m[i - 7] + SIG0(m[i - 15]) + m[i - 16];
-
-	a = ctx->state[0];
-	b = ctx->state[1];
-	c = ctx->state[2];
-	d = ctx->state[3];
-	e = ctx->state[4];
-	f = ctx->state[5];
-	g = ctx->state[6];
-	h = ctx->state[7];
-
-	for (i = 0; i < 64; ++i) {
-		t1 = h + EP1(e) + CH(e,f,g) + k[i] + m[i];
-		t2 = EP0(a) + MAJ(a,b,c);
-		h = g;
-		g = f;
-		f = e;
-		e = d + t1;
-		d = c;
-		c = b;
-		b = a;
-		a = t1 + t2;
+	for ( ; blocks > 0; --blocks, data += 64) {
+		for (i = 0, j = 0; i < 16; ++i, j += 4)
+			m[i] = (data[j] << 24) | (data[j + 1] << 16) | (data[j + 2] << 8) | (data[j + 3]);
+		for ( ; i < 64; ++i)
+			m[i] = SIG1(m[i - 2]) + m[i - 7] + SIG0(m[i - 15]) + m[i - 16];
+
+		a = state[0];
+		b = state[1];
+		c = state[2];
+		d = state[3];
+		e = state[4];
+		f = state[5];
+		g = state[6];
+		h = state[7];
+
+		for (i = 0; i < 64; ++i) {
+			t1 = h + EP1(e) + CH(e,f,g) + sha256_k[i] + m[i];
+			t2 = EP0(a) + MAJ(a,b,c);
+			h = g;
+			g = f;
+			f = e;
+			e = d + t1;
+			d = c;
+			c = b;
+			b = a;
+			a = t1 + t2;
+		}
+
+		state[0] += a;
+		state[1] += b;
+		state[2] += c;
+		state[3] += d;
+		state[4] += e;
+		state[5] += f;
+		state[6] += g;
+		state[7] += h;
 	}
+}
 
-	ctx->state[0] += a;
-	ctx->state[1] += b;
-	ctx->state[2] += c;
-	ctx->state[3] += d;
-	ctx->state[4] += e;
-	ctx->state[5] += f;
-	ctx->state[6] += g;
-	ctx->state[7] += h;
+static void sha256_transform(SHA256_CTX *ctx, const BYTE data[])
+{
+	sha256_compress(ctx->state, data, 1);
 }
 
 void sha256_init(SHA256_CTX *ctx)
@@ -98,7 +93,16 @@ void sha256_init(SHA256_CTX *ctx)
 
 void sha256_update(SHA256_CTX *ctx, const BYTE data[], size_t len)
 {
-	WORD i;
+	size_t i, blocks;
+
+	// Whole blocks are compressed straight from the input when nothing is buffered.
+	if (ctx->datalen == 0 && len >= 64) {
+		blocks = len / 64;
+		sha256_compress(ctx->state, data, blocks);
+		ctx->bitlen += 512 * (unsigned long long)blocks;
+		data += blocks * 64;
+		len -= blocks * 64;
+	}
 
 	for (i = 0; i < len; ++i) {
 		ctx->data[ctx->datalen] = data[i];
@@ -156,3 +160,76 @@ void sha256_final(SHA256_CTX *ctx, BYTE hash[])
 		hash[i + 28] = (ctx->state[7] >> (24 - i * 8)) & 0x000000ff;
 	}
 }
+
+static void sha256_state_to_bytes(const WORD state[8], BYTE out[SHA256_BLOCK_SIZE])
+{
+	int i;
+
+	for (i = 0; i < 8; ++i) {
+		out[i * 4]     = (BYTE)(state[i] >> 24);
+		out[i * 4 + 1] = (BYTE)(state[i] >> 16);
+		out[i * 4 + 2] = (BYTE)(state[i] >> 8);
+		out[i * 4 + 3] = (BYTE)state[i];
+	}
+}
+
+// Compresses "len" bytes continuing from "state" after "prefix_len" bytes, including the final padding.
+static void sha256_absorb_and_pad(WORD state[8], size_t prefix_len, const BYTE data[], size_t len)
+{
+	BYTE tail[128];
+	size_t const full_blocks = len / 64;
+	size_t const remaining = len % 64;
+	size_t const tail_blocks = remaining < 56 ? 1 : 2;
+	unsigned long long const bitlen = ((unsigned long long)prefix_len + len) * 8;
+	int i;
+
+	if (full_blocks > 0)
+		sha256_compress(state, data, full_blocks);
+	memcpy(tail, data + full_blocks * 64, remaining);
+	tail[remaining] = 0x80;
+	memset(tail + remaining + 1, 0, tail_blocks * 64 - remaining - 1);
+	for (i = 0; i < 8; ++i)
+		tail[tail_blocks * 64 - 1 - i] = (BYTE)(bitlen >> (i * 8));
+	sha256_compress(state, tail, tail_blocks);
+}
+
+// Second sha256d round: the first digest goes straight from the state words into a pre-padded block.
+static void sha256_second_round(const WORD first_state[8], BYTE hash[SHA256_BLOCK_SIZE])
+{
+	WORD state[8];
+	BYTE block[64];
+
+	sha256_state_to_bytes(first_state, block);
+	memcpy(block + SHA256_BLOCK_SIZE, sha256_digest_block_padding, sizeof(sha256_digest_block_padding));
+	memcpy(state, sha256_initial_state, sizeof(state));
+	sha256_compress(state, block, 1);
+	sha256_state_to_bytes(state, hash);
+}
+
+void sha256_from_state(const WORD state[8], size_t prefix_len, const BYTE data[], size_t len, BYTE hash[])
+{
+	WORD working_state[8];
+
+	memcpy(working_state, state, sizeof(working_state));
+	sha256_absorb_and_pad(working_state, prefix_len, data, len);
+	sha256_state_to_bytes(working_state, hash);
+}
+
+void sha256(const BYTE data[], size_t len, BYTE hash[])
+{
+	sha256_from_state(sha256_initial_state, 0, data, len, hash);
+}
+
+void sha256d_from_state(const WORD state[8], size_t prefix_len, const BYTE data[], size_t len, BYTE hash[])
+{
+	WORD working_state[8];
+
+	memcpy(working_state, state, sizeof(working_state));
+	sha256_absorb_and_pad(working_state, prefix_len, data, len);
+	sha256_second_round(working_state, hash);
+}
+
+void sha256d(const BYTE data[], size_t len, BYTE hash[])
+{
+	sha256d_from_state(sha256_initial_state, 0, data, len, hash);
+}
@@ -14,6 +14,7 @@
 
 /****************************** MACROS ******************************/
 #define SHA256_BLOCK_SIZE 32            // SHA256 outputs a 32 byte digest
+#define SHA256_MAX_LANES 16             // Widest multi-buffer kernel, in independent messages
 
 /**************************** DATA TYPES ****************************/
 typedef unsigned char BYTE;             // 8-bit byte
@@ -31,4 +32,65 @@ void sha256_init(SHA256_CTX *ctx);
 void sha256_update(SHA256_CTX *ctx, const BYTE data[], size_t len);
 void sha256_final(SHA256_CTX *ctx, BYTE hash[]);
 
+/************************ ONE-SHOT HASHING **************************/
+// Hash a whole message at once, without the SHA256_CTX buffering.
+// sha256d is SHA-256 applied twice, the second round is specialized
+// for its fixed 32-byte input. The _from_state variants continue
+// after a prefix of "prefix_len" bytes (a multiple of 64) already
+// compressed into "state" (the midstate), "data" points past it.
+void sha256(const BYTE data[], size_t len, BYTE hash[]);
+void sha256_from_state(const WORD state[8], size_t prefix_len, const BYTE data[], size_t len, BYTE hash[]);
+void sha256d(const BYTE data[], size_t len, BYTE hash[]);
+void sha256d_from_state(const WORD state[8], size_t prefix_len, const BYTE data[], size_t len, BYTE hash[]);
+
+/******************** ACCELERATED TRANSFORMATION ********************/
+// sha256_compress runs "blocks" consecutive 64-byte blocks through the
+// compression function, using the fastest backend supported by the CPU.
+// The backend is selected once at runtime with cpuid, the portable
+// implementation is used as a fallback.
+void sha256_compress(WORD state[8], const BYTE data[], size_t blocks);
+void sha256_compress_generic(WORD state[8], const BYTE data[], size_t blocks);
+void sha256_compress_shani(WORD state[8], const BYTE data[], size_t blocks);
+
+int sha256_cpu_supports_shani(void);
+int sha256_cpu_supports_avx2(void);
+int sha256_cpu_supports_avx512(void);
+const char *sha256_backend_name(void);
+
+/********************** MULTI-BUFFER HASHING ************************/
+// Multi-buffer kernels compress one 64-byte block for each of several
+// independent messages at once, one message per SIMD lane. "state" is
+// laid out word-major: state[word * lanes + lane].
+void sha256_compress_x8_avx2(WORD state[8 * 8], const BYTE *const data[8]);
+void sha256_compress_x16_avx512(WORD state[8 * 16], const BYTE *const data[16]);
+
+// sha256_multi hashes "count" independent messages of identical length
+// "len", sha256_multi_lanes() of them at a time with the widest kernel
+// worth using on this CPU (1 lane means one message at a time).
+// sha256_multi_backend_name() names that kernel.
+size_t sha256_multi_lanes(void);
+const char *sha256_multi_backend_name(void);
+void sha256_multi(const BYTE *const messages[], size_t count, size_t len, BYTE hashes[][SHA256_BLOCK_SIZE]);
+
+// sha256_multi_from_state continues "count" messages that share a
+// common prefix of "prefix_len" bytes (a multiple of 64) already
+// compressed into "state" (the midstate). "messages" point past the
+// prefix and "len" is the length of each remainder. The sha256d_
+// variants hash every digest a second time.
+void sha256_multi_from_state(
+	const WORD state[8],
+	size_t prefix_len,
+	const BYTE *const messages[],
+	size_t count,
+	size_t len,
+	BYTE hashes[][SHA256_BLOCK_SIZE]);
+void sha256d_multi(const BYTE *const messages[], size_t count, size_t len, BYTE hashes[][SHA256_BLOCK_SIZE]);
+void sha256d_multi_from_state(
+	const WORD state[8],
+	size_t prefix_len,
+	const BYTE *const messages[],
+	size_t count,
+	size_t len,
+	BYTE hashes[][SHA256_BLOCK_SIZE]);
+
 #endif   // SSYBC_LIBRARY_SHA256_SHA256_HPP_
@@ -0,0 +1,94 @@
+/*********************************************************************
+* Filename:   sha256_avx2.cpp
+* Details:    8-lane multi-buffer SHA-256 compression function using
+              AVX2. Each 32-bit SIMD lane carries the state of an
+              independent message, so 8 messages are compressed for
+              roughly the cost of one scalar compression. Only compiled
+              into a real kernel on x86 targets, the caller must check
+              sha256_cpu_supports_avx2() first.
+*********************************************************************/
+
+
+/*************************** HEADER FILES ***************************/
+#include "library/sha256/sha256_internal.hpp"
+
+#ifdef SHA256_X86_AVAILABLE
+#define SHA256_AVX2_AVAILABLE
+#endif
+
+/****************************** MACROS ******************************/
+#ifdef SHA256_AVX2_AVAILABLE
+
+#define ROTRIGHT8(x,n) _mm256_or_si256(_mm256_srli_epi32((x), (n)), _mm256_slli_epi32((x), 32 - (n)))
+
+#define CH8(x,y,z) _mm256_xor_si256(_mm256_and_si256((x), (y)), _mm256_andnot_si256((x), (z)))
+#define MAJ8(x,y,z) _mm256_or_si256(_mm256_and_si256((x), (y)), _mm256_and_si256((z), _mm256_or_si256((x), (y))))
+#define EP08(x) _mm256_xor_si256(_mm256_xor_si256(ROTRIGHT8(x,2), ROTRIGHT8(x,13)), ROTRIGHT8(x,22))
+#define EP18(x) _mm256_xor_si256(_mm256_xor_si256(ROTRIGHT8(x,6), ROTRIGHT8(x,11)), ROTRIGHT8(x,25))
+#define SIG08(x) _mm256_xor_si256(_mm256_xor_si256(ROTRIGHT8(x,7), ROTRIGHT8(x,18)), _mm256_srli_epi32((x), 3))
+#define SIG18(x) _mm256_xor_si256(_mm256_xor_si256(ROTRIGHT8(x,17), ROTRIGHT8(x,19)), _mm256_srli_epi32((x), 10))
+
+/*********************** FUNCTION DEFINITIONS ***********************/
+SHA256_TARGET_AVX2
+void sha256_compress_x8_avx2(WORD state[8 * 8], const BYTE *const data[8])
+{
+	__m256i a, b, c, d, e, f, g, h, t1, t2, m[64];
+	int i;
+
+	sha256_load_transpose_8x8(m, data, 0);
+	sha256_load_transpose_8x8(m + 8, data, 32);
+	for (i = 16; i < 64; ++i)
+		m[i] = _mm256_add_epi32(
+			_mm256_add_epi32(SIG18(m[i - 2]), m[i - 7]),
+			_mm256_add_epi32(SIG08(m[i - 15]), m[i - 16]));
+
+	a = _mm256_loadu_si256((const __m256i *)&state[0 * 8]);
+	b = _mm256_loadu_si256((const __m256i *)&state[1 * 8]);
+	c = _mm256_loadu_si256((const __m256i *)&state[2 * 8]);
+	d = _mm256_loadu_si256((const __m256i *)&state[3 * 8]);
+	e = _mm256_loadu_si256((const __m256i *)&state[4 * 8]);
+	f = _mm256_loadu_si256((const __m256i *)&state[5 * 8]);
+	g = _mm256_loadu_si256((const __m256i *)&state[6 * 8]);
+	h = _mm256_loadu_si256((const __m256i *)&state[7 * 8]);
+
+	for (i = 0; i < 64; ++i) {
+		t1 = _mm256_add_epi32(_mm256_add_epi32(h, EP18(e)), CH8(e,f,g));
+		t1 = _mm256_add_epi32(t1, _mm256_add_epi32(_mm256_set1_epi32((int)sha256_k[i]), m[i]));
+		t2 = _mm256_add_epi32(EP08(a), MAJ8(a,b,c));
+		h = g;
+		g = f;
+		f = e;
+		e = _mm256_add_epi32(d, t1);
+		d = c;
+		c = b;
+		b = a;
+		a = _mm256_add_epi32(t1, t2);
+	}
+
+	_mm256_storeu_si256((__m256i *)&state[0 * 8], _mm256_add_epi32(a, _mm256_loadu_si256((const __m256i *)&state[0 * 8])));
+	_mm256_storeu_si256((__m256i *)&state[1 * 8], _mm256_add_epi32(b, _mm256_loadu_si256((const __m256i *)&state[1 * 8])));
+	_mm256_storeu_si256((__m256i *)&state[2 * 8], _mm256_add_epi32(c, _mm256_loadu_si256((const __m256i *)&state[2 * 8])));
+	_mm256_storeu_si256((__m256i *)&state[3 * 8], _mm256_add_epi32(d, _mm256_loadu_si256((const __m256i *)&state[3 * 8])));
+	_mm256_storeu_si256((__m256i *)&state[4 * 8], _mm256_add_epi32(e, _mm256_loadu_si256((const __m256i *)&state[4 * 8])));
+	_mm256_storeu_si256((__m256i *)&state[5 * 8], _mm256_add_epi32(f, _mm256_loadu_si256((const __m256i *)&state[5 * 8])));
+	_mm256_storeu_si256((__m256i *)&state[6 * 8], _mm256_add_epi32(g, _mm256_loadu_si256((const __m256i *)&state[6 * 8])));
+	_mm256_storeu_si256((__m256i *)&state[7 * 8], _mm256_add_epi32(h, _mm256_loadu_si256((const __m256i *)&state[7 * 8])));
+}
+
+#else  // SHA256_AVX2_AVAILABLE
+
+void sha256_compress_x8_avx2(WORD state[8 * 8], const BYTE *const data[8])
+{
+	WORD lane_state[8];
+	int lane, i;
+
+	for (lane = 0; lane < 8; ++lane) {
+		for (i = 0; i < 8; ++i)
+			lane_state[i] = state[i * 8 + lane];
+		sha256_compress_generic(lane_state, data[lane], 1);
+		for (i = 0; i < 8; ++i)
+			state[i * 8 + lane] = lane_state[i];
+	}
+}
+
+#endif  // SHA256_AVX2_AVAILABLE
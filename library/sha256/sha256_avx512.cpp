@@ -0,0 +1,93 @@
+/*********************************************************************
+* Filename:   sha256_avx512.cpp
+* Details:    16-lane multi-buffer SHA-256 compression function using
+              AVX-512F. Same lane layout as the AVX2 kernel, with twice
+              the lanes and native rotates/ternary logic. Only compiled
+              into a real kernel on x86 targets, the caller must check
+              sha256_cpu_supports_avx512() first.
+*********************************************************************/
+
+
+/*************************** HEADER FILES ***************************/
+#include "library/sha256/sha256_internal.hpp"
+
+#ifdef SHA256_X86_AVAILABLE
+#define SHA256_AVX512_AVAILABLE
+#endif
+
+/****************************** MACROS ******************************/
+#if defined(__GNUC__) || defined(__clang__)
+#define SHA256_TARGET_AVX512 __attribute__((target("avx512f,avx2")))
+#else
+#define SHA256_TARGET_AVX512
+#endif
+
+#ifdef SHA256_AVX512_AVAILABLE
+
+// Ternary logic immediates: 0xCA = x ? y : z, 0xE8 = majority(x, y, z), 0x96 = x ^ y ^ z.
+#define CH16(x,y,z) _mm512_ternarylogic_epi32((x), (y), (z), 0xCA)
+#define MAJ16(x,y,z) _mm512_ternarylogic_epi32((x), (y), (z), 0xE8)
+#define XOR16(x,y,z) _mm512_ternarylogic_epi32((x), (y), (z), 0x96)
+#define EP016(x) XOR16(_mm512_ror_epi32((x), 2), _mm512_ror_epi32((x), 13), _mm512_ror_epi32((x), 22))
+#define EP116(x) XOR16(_mm512_ror_epi32((x), 6), _mm512_ror_epi32((x), 11), _mm512_ror_epi32((x), 25))
+#define SIG016(x) XOR16(_mm512_ror_epi32((x), 7), _mm512_ror_epi32((x), 18), _mm512_srli_epi32((x), 3))
+#define SIG116(x) XOR16(_mm512_ror_epi32((x), 17), _mm512_ror_epi32((x), 19), _mm512_srli_epi32((x), 10))
+
+/*********************** FUNCTION DEFINITIONS ***********************/
+SHA256_TARGET_AVX512
+void sha256_compress_x16_avx512(WORD state[8 * 16], const BYTE *const data[16])
+{
+	__m512i s[8], v[8], t1, t2, m[64];
+	__m256i lo[8], hi[8];
+	int i, half;
+
+	// Lanes 0-7 go to the low 256 bits and lanes 8-15 to the high 256 bits of every message word.
+	for (half = 0; half < 2; ++half) {
+		sha256_load_transpose_8x8(lo, data, half * 32);
+		sha256_load_transpose_8x8(hi, data + 8, half * 32);
+		for (i = 0; i < 8; ++i)
+			m[half * 8 + i] = _mm512_inserti64x4(_mm512_castsi256_si512(lo[i]), hi[i], 1);
+	}
+	for (i = 16; i < 64; ++i)
+		m[i] = _mm512_add_epi32(
+			_mm512_add_epi32(SIG116(m[i - 2]), m[i - 7]),
+			_mm512_add_epi32(SIG016(m[i - 15]), m[i - 16]));
+
+	for (i = 0; i < 8; ++i)
+		v[i] = s[i] = _mm512_loadu_si512((const void *)&state[i * 16]);
+
+	for (i = 0; i < 64; ++i) {
+		t1 = _mm512_add_epi32(_mm512_add_epi32(v[7], EP116(v[4])), CH16(v[4], v[5], v[6]));
+		t1 = _mm512_add_epi32(t1, _mm512_add_epi32(_mm512_set1_epi32((int)sha256_k[i]), m[i]));
+		t2 = _mm512_add_epi32(EP016(v[0]), MAJ16(v[0], v[1], v[2]));
+		v[7] = v[6];
+		v[6] = v[5];
+		v[5] = v[4];
+		v[4] = _mm512_add_epi32(v[3], t1);
+		v[3] = v[2];
+		v[2] = v[1];
+		v[1] = v[0];
+		v[0] = _mm512_add_epi32(t1, t2);
+	}
+
+	for (i = 0; i < 8; ++i)
+		_mm512_storeu_si512((void *)&state[i * 16], _mm512_add_epi32(v[i], s[i]));
+}
+
+#else  // SHA256_AVX512_AVAILABLE
+
+void sha256_compress_x16_avx512(WORD state[8 * 16], const BYTE *const data[16])
+{
+	WORD lane_state[8];
+	int lane, i;
+
+	for (lane = 0; lane < 16; ++lane) {
+		for (i = 0; i < 8; ++i)
+			lane_state[i] = state[i * 16 + lane];
+		sha256_compress_generic(lane_state, data[lane], 1);
+		for (i = 0; i < 8; ++i)
+			state[i * 16 + lane] = lane_state[i];
+	}
+}
+
+#endif  // SHA256_AVX512_AVAILABLE
@@ -0,0 +1,342 @@
+/*********************************************************************
+* Filename:   sha256_dispatch.cpp
+* Details:    Runtime CPU feature detection and selection of the
+              SHA-256 compression backend. Detection runs once, the
+              portable implementation is used on CPUs (or compilers)
+              without hardware SHA support.
+*********************************************************************/
+
+
+/*************************** HEADER FILES ***************************/
+#include "library/sha256/sha256.hpp"
+#include "library/sha256/sha256_internal.hpp"
+
+#include <memory.h>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define SHA256_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+/**************************** DATA TYPES ****************************/
+typedef void (*sha256_compress_fn)(WORD state[8], const BYTE data[], size_t blocks);
+
+typedef void (*sha256_compress_multi_fn)(WORD state[], const BYTE *const data[]);
+
+typedef struct {
+	sha256_compress_fn compress;
+	const char *name;
+} SHA256_BACKEND;
+
+typedef struct {
+	sha256_compress_multi_fn compress;
+	size_t lanes;
+	const char *name;
+} SHA256_MULTI_BACKEND;
+
+/*********************** FUNCTION DEFINITIONS ***********************/
+#ifdef SHA256_X86
+static void sha256_cpuid(unsigned int leaf, unsigned int subleaf, unsigned int regs[4])
+{
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuidex(info, (int)leaf, (int)subleaf);
+	regs[0] = (unsigned int)info[0];
+	regs[1] = (unsigned int)info[1];
+	regs[2] = (unsigned int)info[2];
+	regs[3] = (unsigned int)info[3];
+#else
+	regs[0] = regs[1] = regs[2] = regs[3] = 0;
+	__cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+static unsigned int sha256_cpuid_max_leaf(void)
+{
+	unsigned int regs[4];
+	sha256_cpuid(0, 0, regs);
+	return regs[0];
+}
+
+// Checks that the OS saves the register state enabled by "mask" in XCR0 on context switches.
+static int sha256_os_saves_xstate(unsigned int mask)
+{
+	unsigned int regs[4];
+	unsigned int xcr0;
+
+	sha256_cpuid(1, 0, regs);
+	if (!((regs[2] >> 27) & 1))
+		return 0;
+#if defined(_MSC_VER)
+	xcr0 = (unsigned int)_xgetbv(0);
+#else
+	{
+		unsigned int edx;
+		__asm__ volatile("xgetbv" : "=a"(xcr0), "=d"(edx) : "c"(0));
+		(void)edx;
+	}
+#endif
+	return (xcr0 & mask) == mask;
+}
+#endif  // SHA256_X86
+
+int sha256_cpu_supports_shani(void)
+{
+#ifdef SHA256_X86
+	unsigned int regs[4];
+	int has_ssse3, has_sse41;
+
+	if (sha256_cpuid_max_leaf() < 7)
+		return 0;
+	sha256_cpuid(1, 0, regs);
+	has_ssse3 = (regs[2] >> 9) & 1;
+	has_sse41 = (regs[2] >> 19) & 1;
+	sha256_cpuid(7, 0, regs);
+	return has_ssse3 && has_sse41 && ((regs[1] >> 29) & 1);
+#else
+	return 0;
+#endif
+}
+
+int sha256_cpu_supports_avx2(void)
+{
+#ifdef SHA256_X86
+	unsigned int regs[4];
+
+	if (sha256_cpuid_max_leaf() < 7 || !sha256_os_saves_xstate(0x6))
+		return 0;
+	sha256_cpuid(7, 0, regs);
+	return (regs[1] >> 5) & 1;
+#else
+	return 0;
+#endif
+}
+
+int sha256_cpu_supports_avx512(void)
+{
+#ifdef SHA256_X86
+	unsigned int regs[4];
+
+	// XCR0 must enable SSE, AVX, opmask and both halves of the ZMM register file.
+	if (sha256_cpuid_max_leaf() < 7 || !sha256_os_saves_xstate(0xE6))
+		return 0;
+	sha256_cpuid(7, 0, regs);
+	return ((regs[1] >> 16) & 1) && ((regs[1] >> 5) & 1);
+#else
+	return 0;
+#endif
+}
+
+static SHA256_BACKEND sha256_select_backend(void)
+{
+	SHA256_BACKEND backend;
+
+	if (sha256_cpu_supports_shani()) {
+		backend.compress = sha256_compress_shani;
+		backend.name = "sha-ni";
+	}
+	else {
+		backend.compress = sha256_compress_generic;
+		backend.name = "generic";
+	}
+	return backend;
+}
+
+static const SHA256_BACKEND &sha256_backend(void)
+{
+	// Function-local static, initialized exactly once even when first used from several mining threads.
+	static const SHA256_BACKEND backend = sha256_select_backend();
+	return backend;
+}
+
+void sha256_compress(WORD state[8], const BYTE data[], size_t blocks)
+{
+	sha256_backend().compress(state, data, blocks);
+}
+
+const char *sha256_backend_name(void)
+{
+	return sha256_backend().name;
+}
+
+static void sha256_compress_x1(WORD state[8], const BYTE *const data[1])
+{
+	sha256_compress(state, data[0], 1);
+}
+
+static SHA256_MULTI_BACKEND sha256_select_multi_backend(void)
+{
+	SHA256_MULTI_BACKEND backend;
+
+	// 16 AVX-512 lanes outrun a SHA-NI core by a wide margin. One SHA-NI core keeps up with 8 AVX2 lanes without
+	// any batching though, so the AVX2 kernel only pays off on CPUs without it.
+	if (sha256_cpu_supports_avx512()) {
+		backend.compress = sha256_compress_x16_avx512;
+		backend.lanes = 16;
+		backend.name = "avx512x16";
+	}
+	else if (sha256_cpu_supports_avx2() && !sha256_cpu_supports_shani()) {
+		backend.compress = sha256_compress_x8_avx2;
+		backend.lanes = 8;
+		backend.name = "avx2x8";
+	}
+	else {
+		backend.compress = sha256_compress_x1;
+		backend.lanes = 1;
+		backend.name = sha256_backend_name();
+	}
+	return backend;
+}
+
+static const SHA256_MULTI_BACKEND &sha256_multi_backend(void)
+{
+	static const SHA256_MULTI_BACKEND backend = sha256_select_multi_backend();
+	return backend;
+}
+
+size_t sha256_multi_lanes(void)
+{
+	return sha256_multi_backend().lanes;
+}
+
+const char *sha256_multi_backend_name(void)
+{
+	return sha256_multi_backend().name;
+}
+
+// Hashes exactly "lanes" messages that continue from "initial_state" after "prefix_len" bytes, the last block(s) of
+// every message are padded in a per-lane buffer. With "is_double" set, every digest is hashed again from a pre-padded
+// block filled straight from the state words.
+static void sha256_multi_group(
+	const SHA256_MULTI_BACKEND &backend,
+	int is_double,
+	const WORD initial_state[8],
+	size_t prefix_len,
+	const BYTE *const messages[],
+	size_t len,
+	BYTE hashes[][SHA256_BLOCK_SIZE])
+{
+	WORD state[8 * SHA256_MAX_LANES];
+	BYTE tail[SHA256_MAX_LANES][128];
+	const BYTE *blocks[SHA256_MAX_LANES];
+	size_t const lanes = backend.lanes;
+	size_t const full_blocks = len / 64;
+	size_t const remaining = len % 64;
+	size_t const tail_blocks = remaining < 56 ? 1 : 2;
+	unsigned long long const bitlen = ((unsigned long long)prefix_len + len) * 8;
+	size_t lane, i, block;
+
+	for (i = 0; i < 8; ++i)
+		for (lane = 0; lane < lanes; ++lane)
+			state[i * lanes + lane] = initial_state[i];
+
+	for (block = 0; block < full_blocks; ++block) {
+		for (lane = 0; lane < lanes; ++lane)
+			blocks[lane] = messages[lane] + block * 64;
+		backend.compress(state, blocks);
+	}
+
+	for (lane = 0; lane < lanes; ++lane) {
+		memcpy(tail[lane], messages[lane] + full_blocks * 64, remaining);
+		tail[lane][remaining] = 0x80;
+		memset(tail[lane] + remaining + 1, 0, tail_blocks * 64 - remaining - 1);
+		for (i = 0; i < 8; ++i)
+			tail[lane][tail_blocks * 64 - 1 - i] = (BYTE)(bitlen >> (i * 8));
+	}
+	for (block = 0; block < tail_blocks; ++block) {
+		for (lane = 0; lane < lanes; ++lane)
+			blocks[lane] = tail[lane] + block * 64;
+		backend.compress(state, blocks);
+	}
+
+	if (is_double) {
+		for (lane = 0; lane < lanes; ++lane) {
+			for (i = 0; i < 8; ++i) {
+				WORD const word = state[i * lanes + lane];
+				tail[lane][i * 4] = (BYTE)(word >> 24);
+				tail[lane][i * 4 + 1] = (BYTE)(word >> 16);
+				tail[lane][i * 4 + 2] = (BYTE)(word >> 8);
+				tail[lane][i * 4 + 3] = (BYTE)word;
+			}
+			memcpy(tail[lane] + SHA256_BLOCK_SIZE, sha256_digest_block_padding, sizeof(sha256_digest_block_padding));
+			blocks[lane] = tail[lane];
+		}
+		for (i = 0; i < 8; ++i)
+			for (lane = 0; lane < lanes; ++lane)
+				state[i * lanes + lane] = sha256_initial_state[i];
+		backend.compress(state, blocks);
+	}
+
+	for (lane = 0; lane < lanes; ++lane) {
+		for (i = 0; i < 8; ++i) {
+			WORD const word = state[i * lanes + lane];
+			hashes[lane][i * 4] = (BYTE)(word >> 24);
+			hashes[lane][i * 4 + 1] = (BYTE)(word >> 16);
+			hashes[lane][i * 4 + 2] = (BYTE)(word >> 8);
+			hashes[lane][i * 4 + 3] = (BYTE)word;
+		}
+	}
+}
+
+static void sha256_multi_rounds(
+	int is_double,
+	const WORD state[8],
+	size_t prefix_len,
+	const BYTE *const messages[],
+	size_t count,
+	size_t len,
+	BYTE hashes[][SHA256_BLOCK_SIZE])
+{
+	const SHA256_MULTI_BACKEND &backend = sha256_multi_backend();
+	size_t const lanes = backend.lanes;
+	const BYTE *group[SHA256_MAX_LANES];
+	BYTE group_hashes[SHA256_MAX_LANES][SHA256_BLOCK_SIZE];
+	size_t done, lane;
+
+	for (done = 0; done + lanes <= count; done += lanes)
+		sha256_multi_group(backend, is_double, state, prefix_len, messages + done, len, hashes + done);
+
+	// Idle lanes of the last, partial group re-hash the first message of the group and are discarded.
+	if (done < count) {
+		for (lane = 0; lane < lanes; ++lane)
+			group[lane] = messages[done + (done + lane < count ? lane : 0)];
+		sha256_multi_group(backend, is_double, state, prefix_len, group, len, group_hashes);
+		memcpy(hashes + done, group_hashes, (count - done) * SHA256_BLOCK_SIZE);
+	}
+}
+
+void sha256_multi_from_state(
+	const WORD state[8],
+	size_t prefix_len,
+	const BYTE *const messages[],
+	size_t count,
+	size_t len,
+	BYTE hashes[][SHA256_BLOCK_SIZE])
+{
+	sha256_multi_rounds(0, state, prefix_len, messages, count, len, hashes);
+}
+
+void sha256_multi(const BYTE *const messages[], size_t count, size_t len, BYTE hashes[][SHA256_BLOCK_SIZE])
+{
+	sha256_multi_rounds(0, sha256_initial_state, 0, messages, count, len, hashes);
+}
+
+void sha256d_multi_from_state(
+	const WORD state[8],
+	size_t prefix_len,
+	const BYTE *const messages[],
+	size_t count,
+	size_t len,
+	BYTE hashes[][SHA256_BLOCK_SIZE])
+{
+	sha256_multi_rounds(1, state, prefix_len, messages, count, len, hashes);
+}
+
+void sha256d_multi(const BYTE *const messages[], size_t count, size_t len, BYTE hashes[][SHA256_BLOCK_SIZE])
+{
+	sha256_multi_rounds(1, sha256_initial_state, 0, messages, count, len, hashes);
+}
@@ -0,0 +1,87 @@
+/*********************************************************************
+* Filename:   sha256_internal.hpp
+* Details:    Definitions shared by the SHA-256 backends and not part
+              of the public API: the round constants, the initial
+              state, the padding of the second sha256d round, and the
+              8x8 word transpose the AVX2 and AVX-512 multi-buffer
+              kernels load their message lanes with. The transpose is
+              only defined on x86 targets.
+*********************************************************************/
+
+#ifndef SSYBC_LIBRARY_SHA256_SHA256_INTERNAL_HPP_
+#define SSYBC_LIBRARY_SHA256_SHA256_INTERNAL_HPP_
+
+/*************************** HEADER FILES ***************************/
+#include "library/sha256/sha256.hpp"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define SHA256_X86_AVAILABLE
+#include <immintrin.h>
+#endif
+
+/****************************** MACROS ******************************/
+#if defined(__GNUC__) || defined(__clang__)
+#define SHA256_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define SHA256_TARGET_AVX2
+#endif
+
+/**************************** VARIABLES *****************************/
+static const WORD sha256_k[64] = {
+	0x428a2f98,0x71374491,0xb5c0fbcf,0xe9b5dba5,0x3956c25b,0x59f111f1,0x923f82a4,0xab1c5ed5,
+	0xd807aa98,0x12835b01,0x243185be,0x550c7dc3,0x72be5d74,0x80deb1fe,0x9bdc06a7,0xc19bf174,
+	0xe49b69c1,0xefbe4786,0x0fc19dc6,0x240ca1cc,0x2de92c6f,0x4a7484aa,0x5cb0a9dc,0x76f988da,
+	0x983e5152,0xa831c66d,0xb00327c8,0xbf597fc7,0xc6e00bf3,0xd5a79147,0x06ca6351,0x14292967,
+	0x27b70a85,0x2e1b2138,0x4d2c6dfc,0x53380d13,0x650a7354,0x766a0abb,0x81c2c92e,0x92722c85,
+	0xa2bfe8a1,0xa81a664b,0xc24b8b70,0xc76c51a3,0xd192e819,0xd6990624,0xf40e3585,0x106aa070,
+	0x19a4c116,0x1e376c08,0x2748774c,0x34b0bcb5,0x391c0cb3,0x4ed8aa4a,0x5b9cca4f,0x682e6ff3,
+	0x748f82ee,0x78a5636f,0x84c87814,0x8cc70208,0x90befffa,0xa4506ceb,0xbef9a3f7,0xc67178f2
+};
+
+static const WORD sha256_initial_state[8] = {
+	0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+// Padding of the second sha256d round, its message is always one 32-byte digest: the 0x80 terminator right after
+// the digest and the length of 256 bits at the end of the block.
+static const BYTE sha256_digest_block_padding[32] = {
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00
+};
+
+/*********************** FUNCTION DEFINITIONS ***********************/
+#ifdef SHA256_X86_AVAILABLE
+
+// Loads 8 consecutive big-endian words from each of the 8 rows and transposes them, so that m[i] holds word i of
+// every row, one row per lane.
+SHA256_TARGET_AVX2
+static inline void sha256_load_transpose_8x8(__m256i m[8], const BYTE *const rows[8], size_t offset)
+{
+	const __m256i byte_swap_mask = _mm256_set_epi8(
+		12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3,
+		12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+	__m256i r[8], t[8], u[8];
+	int i;
+
+	for (i = 0; i < 8; ++i)
+		r[i] = _mm256_loadu_si256((const __m256i *)(rows[i] + offset));
+
+	for (i = 0; i < 8; i += 2) {
+		t[i] = _mm256_unpacklo_epi32(r[i], r[i + 1]);
+		t[i + 1] = _mm256_unpackhi_epi32(r[i], r[i + 1]);
+	}
+	for (i = 0; i < 8; i += 4) {
+		u[i] = _mm256_unpacklo_epi64(t[i], t[i + 2]);
+		u[i + 1] = _mm256_unpackhi_epi64(t[i], t[i + 2]);
+		u[i + 2] = _mm256_unpacklo_epi64(t[i + 1], t[i + 3]);
+		u[i + 3] = _mm256_unpackhi_epi64(t[i + 1], t[i + 3]);
+	}
+	for (i = 0; i < 4; ++i) {
+		m[i] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(u[i], u[i + 4], 0x20), byte_swap_mask);
+		m[i + 4] = _mm256_shuffle_epi8(_mm256_permute2x128_si256(u[i], u[i + 4], 0x31), byte_swap_mask);
+	}
+}
+
+#endif  // SHA256_X86_AVAILABLE
+
+#endif   // SSYBC_LIBRARY_SHA256_SHA256_INTERNAL_HPP_
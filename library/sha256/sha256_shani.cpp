@@ -0,0 +1,81 @@
+/*********************************************************************
+* Filename:   sha256_shani.cpp
+* Details:    SHA-256 compression function using the Intel SHA
+              extensions (SHA-NI), available on Intel Goldmont and
+              later, Ice Lake and later, and AMD Zen.
+              Only compiled into a real kernel on x86 targets, the
+              caller must check sha256_cpu_supports_shani() first.
+*********************************************************************/
+
+
+/*************************** HEADER FILES ***************************/
+#include "library/sha256/sha256_internal.hpp"
+
+#ifdef SHA256_X86_AVAILABLE
+#define SHA256_SHANI_AVAILABLE
+#endif
+
+/****************************** MACROS ******************************/
+#if defined(__GNUC__) || defined(__clang__)
+#define SHA256_TARGET_SHANI __attribute__((target("sha,sse4.1,ssse3")))
+#else
+#define SHA256_TARGET_SHANI
+#endif
+
+#ifdef SHA256_SHANI_AVAILABLE
+
+/*********************** FUNCTION DEFINITIONS ***********************/
+SHA256_TARGET_SHANI
+void sha256_compress_shani(WORD state[8], const BYTE data[], size_t blocks)
+{
+	const __m128i byte_swap_mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+	__m128i state0, state1, abef_save, cdgh_save, msg, tmp, w[4];
+	int g;
+
+	// The SHA instructions operate on the state as (A, B, E, F) and (C, D, G, H).
+	tmp = _mm_loadu_si128((const __m128i *)&state[0]);
+	state1 = _mm_loadu_si128((const __m128i *)&state[4]);
+	tmp = _mm_shuffle_epi32(tmp, 0xB1);
+	state1 = _mm_shuffle_epi32(state1, 0x1B);
+	state0 = _mm_alignr_epi8(tmp, state1, 8);
+	state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+	for ( ; blocks > 0; --blocks, data += 64) {
+		abef_save = state0;
+		cdgh_save = state1;
+
+		// Each iteration runs 4 rounds, message words 16 to 63 are expanded from the previous 16 on the fly.
+		for (g = 0; g < 16; ++g) {
+			if (g < 4) {
+				w[g] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + g * 16)), byte_swap_mask);
+			} else {
+				tmp = _mm_sha256msg1_epu32(w[g & 3], w[(g + 1) & 3]);
+				tmp = _mm_add_epi32(tmp, _mm_alignr_epi8(w[(g + 3) & 3], w[(g + 2) & 3], 4));
+				w[g & 3] = _mm_sha256msg2_epu32(tmp, w[(g + 3) & 3]);
+			}
+			msg = _mm_add_epi32(w[g & 3], _mm_loadu_si128((const __m128i *)&sha256_k[g * 4]));
+			state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+			msg = _mm_shuffle_epi32(msg, 0x0E);
+			state0 = _mm_sha256rnds2_epu32(state0, state1, msg);
+		}
+
+		state0 = _mm_add_epi32(state0, abef_save);
+		state1 = _mm_add_epi32(state1, cdgh_save);
+	}
+
+	tmp = _mm_shuffle_epi32(state0, 0x1B);
+	state1 = _mm_shuffle_epi32(state1, 0xB1);
+	state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+	state1 = _mm_alignr_epi8(state1, tmp, 8);
+	_mm_storeu_si128((__m128i *)&state[0], state0);
+	_mm_storeu_si128((__m128i *)&state[4], state1);
+}
+
+#else  // SHA256_SHANI_AVAILABLE
+
+void sha256_compress_shani(WORD state[8], const BYTE data[], size_t blocks)
+{
+	sha256_compress_generic(state, data, blocks);
+}
+
+#endif  // SHA256_SHANI_AVAILABLE
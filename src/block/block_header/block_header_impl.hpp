@@ -26,7 +26,6 @@
 #include "include/ssybc/block/block_header/block_header.hpp"
 
 #include "include/ssybc/utility/utility.hpp"
-#include "include/ssybc/utility/operator.hpp"
 #include "include/ssybc/binary_data_converter/binary_data_converter_default.hpp"
 
 
@@ -43,8 +42,8 @@ inline ssybc::BlockHeader<HashCalculatorT>::BlockHeader(
   BlockNonce const nonce):
   version_{ version },
   index_{ index },
-  merkle_root_{ merkle_root.begin(), merkle_root.end() },
-  previous_hash_{ previous_hash.begin(), previous_hash.end() },
+  merkle_root_{ merkle_root },
+  previous_hash_{ previous_hash },
   time_stamp_{ time_stamp },
   nonce_{ nonce },
   hash_{ HashCalculatorT().Hash(Binary()) }
@@ -71,25 +70,19 @@ inline ssybc::BlockHeader<HashCalculatorT>::BlockHeader(
 
 template<typename HashCalculatorT>
 inline ssybc::BlockHeader<HashCalculatorT>::BlockHeader(BlockHeader const & header) :
-  BlockHeader(
-    header.Version(),
-    header.Index(),
-    header.MerkleRoot(),
-    header.PreviousHash(),
-    header.TimeStamp(),
-    header.Nonce())
+  version_{ header.version_ },
+  index_{ header.index_ },
+  previous_hash_{ header.previous_hash_ },
+  merkle_root_{ header.merkle_root_ },
+  time_stamp_{ header.time_stamp_ },
+  nonce_{ header.nonce_ },
+  hash_{ header.hash_ }
 { EMPTY_BLOCK }
 
 
 template<typename HashCalculatorT>
 inline ssybc::BlockHeader<HashCalculatorT>::BlockHeader(BlockHeader && header) :
-  BlockHeader(
-    header.Version(),
-    header.Index(),
-    header.MerkleRoot(),
-    header.PreviousHash(),
-    header.TimeStamp(),
-    header.Nonce())
+  BlockHeader(static_cast<BlockHeader const &>(header))
 { EMPTY_BLOCK }
 
 
@@ -119,6 +112,18 @@ inline ssybc::BlockHeader<HashCalculatorT>::BlockHeader(BinaryData && binary_dat
 { EMPTY_BLOCK }
 
 
+template<typename HashCalculatorT>
+inline ssybc::BlockHeader<HashCalculatorT>::BlockHeader(BinaryData const & binary_data, BlockHash const & hash) :
+  version_{ VersionFromBinaryData_(binary_data) },
+  index_{ IndexFromBinaryData_(binary_data) },
+  previous_hash_{ PreviousHashFromBinaryData_(binary_data) },
+  merkle_root_{ MerkleRootFromBinaryData_(binary_data) },
+  time_stamp_{ TimeStampFromBinaryData_(binary_data) },
+  nonce_{ NonceFromBinaryData_(binary_data) },
+  hash_{ hash }
+{ EMPTY_BLOCK }
+
+
 // --------------------------------------------------- Public Method --------------------------------------------------
 
 
@@ -137,13 +142,13 @@ inline ssybc::BlockIndex ssybc::BlockHeader<HashCalculatorT>::Index() const
 template<typename HashCalculatorT>
 inline ssybc::BlockHash ssybc::BlockHeader<HashCalculatorT>::MerkleRoot() const
 {
-  return BinaryData{ merkle_root_.begin(), merkle_root_.end() };
+  return merkle_root_;
 }
 
 template<typename HashCalculatorT>
 inline ssybc::BlockHash ssybc::BlockHeader<HashCalculatorT>::PreviousHash() const
 {
-  return BinaryData{ previous_hash_.begin(), previous_hash_.end() };;
+  return previous_hash_;
 }
 
 template<typename HashCalculatorT>
@@ -175,7 +180,7 @@ inline ssybc::BinaryData ssybc::BlockHeader<HashCalculatorT>::Binary() const
 template<typename HashCalculatorT>
 inline ssybc::BlockHash ssybc::BlockHeader<HashCalculatorT>::Hash() const
 {
-  return BinaryData{ hash_.begin(), hash_.end() };
+  return hash_;
 }
 
 
@@ -273,13 +278,13 @@ inline ssybc::BinaryData ssybc::BlockHeader<HashCalculatorT>::IndexAsBinary_() c
 template<typename HashCalculatorT>
 inline ssybc::BinaryData ssybc::BlockHeader<HashCalculatorT>::MerkleRootAsBinary_() const
 {
-  return BinaryDataConverterDefault<BlockHash>().BinaryDataFromData(MerkleRoot());
+  return merkle_root_.Binary();
 }
 
 template<typename HashCalculatorT>
 inline ssybc::BinaryData ssybc::BlockHeader<HashCalculatorT>::PreviousHashAsBinary_() const
 {
-  return BinaryDataConverterDefault<BlockHash>().BinaryDataFromData(PreviousHash());
+  return previous_hash_.Binary();
 }
 
 template<typename HashCalculatorT>
@@ -318,24 +323,16 @@ inline ssybc::BlockIndex ssybc::BlockHeader<HashCalculatorT>::IndexFromBinaryDat
 template<typename HashCalculatorT>
 inline ssybc::BlockHash ssybc::BlockHeader<HashCalculatorT>::MerkleRootFromBinaryData_(BinaryData const & data) const
 {
-  auto begin_iter = data.begin();
-  std::advance(begin_iter, sizeof(BlockVersion) + sizeof(BlockIndex));
-  auto end_iter = begin_iter;
-  std::advance(end_iter, static_cast<std::size_t>(HashCalculatorT().SizeOfHashInBytes()));
-  BinaryData const data_tmp{ begin_iter, end_iter };
-  return BinaryDataConverterDefault<BlockHash>().DataFromBinaryData(data_tmp);
+  auto const offset = sizeof(BlockVersion) + sizeof(BlockIndex);
+  return BlockHash(data.data() + offset, HashCalculatorT().SizeOfHashInBytes());
 }
 
 template<typename HashCalculatorT>
 inline ssybc::BlockHash ssybc::BlockHeader<HashCalculatorT>::PreviousHashFromBinaryData_(BinaryData const & data) const
 {
-  auto begin_iter = data.begin();
   auto const size_of_hash = static_cast<std::size_t>(HashCalculatorT().SizeOfHashInBytes());
-  std::advance(begin_iter, sizeof(BlockVersion) + sizeof(BlockIndex) + size_of_hash);
-  auto end_iter = begin_iter;
-  std::advance(end_iter, size_of_hash);
-  BinaryData const data_tmp{ begin_iter, end_iter };
-  return BinaryDataConverterDefault<BlockHash>().DataFromBinaryData(data_tmp);
+  auto const offset = sizeof(BlockVersion) + sizeof(BlockIndex) + size_of_hash;
+  return BlockHash(data.data() + offset, size_of_hash);
 }
 
 template<typename HashCalculatorT>
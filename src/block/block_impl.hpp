@@ -24,7 +24,6 @@
 
 #include "include/ssybc/block/block.hpp"
 #include "include/ssybc/utility/utility.hpp"
-#include "include/ssybc/utility/operator.hpp"
 
 #include <exception>
 #include <cassert>
@@ -260,6 +259,41 @@ ssybc::Block<
 }
 
 
+template<
+  typename DataT,
+  template<typename> class ContentBinaryConverterTemplate,
+  typename HeaderHashCalculatorT,
+  typename ContentHashCalculatorT
+>
+ssybc::Block<
+  DataT,
+  ContentBinaryConverterTemplate,
+  HeaderHashCalculatorT,
+  ContentHashCalculatorT>::Block(BinaryData &&binary_data, BlockHash const &header_hash):
+  Block(std::forward<BinaryData>(binary_data), header_hash, true)
+{ EMPTY_BLOCK }
+
+
+template<
+  typename DataT,
+  template<typename> class ContentBinaryConverterTemplate,
+  typename HeaderHashCalculatorT,
+  typename ContentHashCalculatorT
+>
+ssybc::Block<
+  DataT,
+  ContentBinaryConverterTemplate,
+  HeaderHashCalculatorT,
+  ContentHashCalculatorT>::Block(BinaryData &&binary_data, BlockHash const &header_hash, bool const verifies_content):
+  header_{ HeaderFromBinaryData_(std::forward<BinaryData>(binary_data), header_hash) },
+  content_ptr_{ ContentPtrFromBinaryData_(std::forward<BinaryData>(binary_data)) }
+{
+  if (verifies_content && !IsHeaderOnly() && content_ptr_->Hash() != header_.MerkleRoot()) {
+    ThrowContentHashDoesNotMatchMerkleRootException_();
+  }
+}
+
+
 // --------------------------------------------------- Public Method --------------------------------------------------
 
 
@@ -289,7 +323,7 @@ inline auto ssybc::Block<
   DataT,
   ContentBinaryConverterTemplate,
   HeaderHashCalculatorT,
-  ContentHashCalculatorT>::Header() const -> BlockHeaderType
+  ContentHashCalculatorT>::Header() const -> BlockHeaderType const &
 {
   return header_;
 }
@@ -442,6 +476,29 @@ inline auto ssybc::Block<
 }
 
 
+template<
+  typename DataT,
+  template<typename> class ContentBinaryConverterTemplate,
+  typename HeaderHashCalculatorT,
+  typename ContentHashCalculatorT
+>
+inline auto ssybc::Block<
+  DataT,
+  ContentBinaryConverterTemplate,
+  HeaderHashCalculatorT,
+  ContentHashCalculatorT>::HeaderFromBinaryData_(
+    BinaryData &&binary_data,
+    BlockHash const &header_hash) const -> BlockHeaderType
+{
+  auto begin_iter = binary_data.begin();
+  auto end_iter = binary_data.begin();
+  std::advance(end_iter, static_cast<std::size_t>(BlockHeaderType::SizeOfBinary()));
+  auto header = BlockHeaderType(BinaryData{ begin_iter, end_iter }, header_hash);
+  binary_data.erase(begin_iter, end_iter);
+  return header;
+}
+
+
 template<
   typename DataT,
   template<typename> class ContentBinaryConverterTemplate,
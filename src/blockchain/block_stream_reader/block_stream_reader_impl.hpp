@@ -0,0 +1,170 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_SRC_BLOCKCHAIN_BLOCK_STREAM_READER_BLOCK_STREAM_READER_IMPL_HPP_
+#define SSYBC_SRC_BLOCKCHAIN_BLOCK_STREAM_READER_BLOCK_STREAM_READER_IMPL_HPP_
+
+#include "include/ssybc/blockchain/block_stream_reader/block_stream_reader.hpp"
+#include "include/ssybc/binary_data_converter/binary_data_converter_default.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+
+template<typename BlockT>
+inline ssybc::BlockStreamReader<BlockT>::BlockStreamReader(BinaryData const &binary_data):
+  data_{ binary_data.data() },
+  data_size_{ binary_data.size() }
+{ EMPTY_BLOCK }
+
+
+template<typename BlockT>
+inline ssybc::BlockStreamReader<BlockT>::BlockStreamReader(std::istream &stream):
+  stream_ptr_{ &stream }
+{ EMPTY_BLOCK }
+
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+
+template<typename BlockT>
+inline bool ssybc::BlockStreamReader<BlockT>::NextBlockBinary(BinaryData &block_binary)
+{
+  block_binary.clear();
+  if (IsAtEnd_()) {
+    return false;
+  }
+  auto const content_size = ReadHeaderAndContentSize_(block_binary);
+  if (!ReadBytes_(block_binary, content_size)) {
+    throw std::runtime_error("Block binary data ends in the middle of a block content.");
+  }
+  return true;
+}
+
+
+template<typename BlockT>
+inline bool ssybc::BlockStreamReader<BlockT>::NextBlockExtent(SizeT &block_offset, SizeT &block_size)
+{
+  if (IsAtEnd_()) {
+    return false;
+  }
+  block_offset = offset_;
+  BinaryData header_binary{};
+  auto const content_size = ReadHeaderAndContentSize_(header_binary);
+  if (!SkipBytes_(content_size)) {
+    throw std::runtime_error("Block binary data ends in the middle of a block content.");
+  }
+  block_size = offset_ - block_offset;
+  return true;
+}
+
+
+template<typename BlockT>
+inline auto ssybc::BlockStreamReader<BlockT>::Offset() const -> SizeT
+{
+  return offset_;
+}
+
+
+// -------------------------------------------------- Private Method --------------------------------------------------
+
+
+// A stream is read in chunks of at most a megabyte, so a corrupt content size fails at the end of the data instead
+// of allocating the claimed size up front.
+template<typename BlockT>
+inline bool ssybc::BlockStreamReader<BlockT>::ReadBytes_(BinaryData &binary_data, SizeT const size)
+{
+  if (stream_ptr_ == nullptr) {
+    auto const read_size = std::min(size, data_size_ - offset_);
+    binary_data.insert(binary_data.end(), data_ + offset_, data_ + offset_ + read_size);
+    offset_ += read_size;
+    return read_size == size;
+  }
+
+  SizeT remaining_size{ size };
+  while (remaining_size > 0) {
+    auto const chunk_size = std::min<SizeT>(remaining_size, kNumberOfBytesInMB);
+    auto const old_size = binary_data.size();
+    binary_data.resize(static_cast<std::size_t>(old_size + chunk_size));
+    stream_ptr_->read(
+      reinterpret_cast<char *>(binary_data.data() + old_size),
+      static_cast<std::streamsize>(chunk_size));
+    auto const read_size = static_cast<SizeT>(stream_ptr_->gcount());
+    offset_ += read_size;
+    if (read_size < chunk_size) {
+      binary_data.resize(static_cast<std::size_t>(old_size + read_size));
+      return false;
+    }
+    remaining_size -= chunk_size;
+  }
+  return true;
+}
+
+
+template<typename BlockT>
+inline bool ssybc::BlockStreamReader<BlockT>::SkipBytes_(SizeT const size)
+{
+  if (stream_ptr_ == nullptr) {
+    auto const skipped_size = std::min(size, data_size_ - offset_);
+    offset_ += skipped_size;
+    return skipped_size == size;
+  }
+
+  SizeT remaining_size{ size };
+  while (remaining_size > 0) {
+    auto const chunk_size = std::min<SizeT>(remaining_size, kNumberOfBytesInMB);
+    stream_ptr_->ignore(static_cast<std::streamsize>(chunk_size));
+    auto const skipped_size = static_cast<SizeT>(stream_ptr_->gcount());
+    offset_ += skipped_size;
+    if (skipped_size < chunk_size) {
+      return false;
+    }
+    remaining_size -= chunk_size;
+  }
+  return true;
+}
+
+
+template<typename BlockT>
+inline auto ssybc::BlockStreamReader<BlockT>::ReadHeaderAndContentSize_(BinaryData &block_binary) -> SizeT
+{
+  auto const size_of_header = BlockType::BlockHeaderType::SizeOfBinary();
+  if (!ReadBytes_(block_binary, size_of_header + sizeof(SizeT))) {
+    throw std::runtime_error("Block binary data ends in the middle of a block header.");
+  }
+  BinaryData const content_size_binary{ block_binary.end() - sizeof(SizeT), block_binary.end() };
+  return BinaryDataConverterDefault<SizeT>().DataFromBinaryData(content_size_binary);
+}
+
+
+template<typename BlockT>
+inline bool ssybc::BlockStreamReader<BlockT>::IsAtEnd_()
+{
+  if (stream_ptr_ == nullptr) {
+    return offset_ >= data_size_;
+  }
+  return stream_ptr_->peek() == std::istream::traits_type::eof();
+}
+
+
+#endif  // SSYBC_SRC_BLOCKCHAIN_BLOCK_STREAM_READER_BLOCK_STREAM_READER_IMPL_HPP_
@@ -0,0 +1,138 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_SRC_BLOCKCHAIN_BLOCKCHAIN_CHECKPOINTS_BLOCKCHAIN_CHECKPOINTS_IMPL_HPP_
+#define SSYBC_SRC_BLOCKCHAIN_BLOCKCHAIN_CHECKPOINTS_BLOCKCHAIN_CHECKPOINTS_IMPL_HPP_
+
+#include "include/ssybc/blockchain/blockchain_checkpoints/blockchain_checkpoints.hpp"
+#include "include/ssybc/utility/utility.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+
+inline ssybc::BlockchainCheckpoints::BlockchainCheckpoints(std::string const &text)
+{
+  std::istringstream text_stream{ text };
+  std::string line{};
+  while (std::getline(text_stream, line)) {
+    if (line.find_first_not_of(" \t\r") == std::string::npos) {
+      continue;
+    }
+    std::istringstream line_stream{ line };
+    BlockIndex height{ 0 };
+    std::string hash_string{};
+    std::string rest{};
+    if (!(line_stream >> height >> hash_string) || line_stream >> rest) {
+      throw std::invalid_argument("Cannot parse checkpoint \"" + line + "\".");
+    }
+    auto const hash_binary = util::BytesFromHexString(hash_string);
+    if (hash_binary.size() != kSizeOfBlockHashInBytes) {
+      throw std::invalid_argument("Cannot parse checkpoint \"" + line + "\", hash has the wrong size.");
+    }
+    Add(height, BlockHash{ hash_binary });
+  }
+}
+
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+
+inline void ssybc::BlockchainCheckpoints::Add(BlockIndex const height, BlockHash const &header_hash)
+{
+  hash_at_height_dict_[height] = header_hash;
+}
+
+
+inline auto ssybc::BlockchainCheckpoints::Size() const -> SizeT
+{
+  return static_cast<SizeT>(hash_at_height_dict_.size());
+}
+
+
+inline bool ssybc::BlockchainCheckpoints::IsEmpty() const
+{
+  return hash_at_height_dict_.empty();
+}
+
+
+inline auto ssybc::BlockchainCheckpoints::HighestHeight() const -> BlockIndex
+{
+  if (IsEmpty()) {
+    throw std::logic_error("Cannot get highest height of empty checkpoints.");
+  }
+  return hash_at_height_dict_.rbegin()->first;
+}
+
+
+inline bool ssybc::BlockchainCheckpoints::Covers(BlockIndex const height) const
+{
+  return !IsEmpty() && height <= HighestHeight();
+}
+
+
+inline bool ssybc::BlockchainCheckpoints::IsConsistentWith(BlockIndex const height, BlockHash const &header_hash) const
+{
+  auto const iter = hash_at_height_dict_.find(height);
+  return iter == hash_at_height_dict_.end() || iter->second == header_hash;
+}
+
+
+inline std::string ssybc::BlockchainCheckpoints::Text() const
+{
+  std::string result{};
+  for (auto const &height_and_hash: hash_at_height_dict_) {
+    result += util::ToString(height_and_hash.first) + " " + util::HexStringFromBytes(height_and_hash.second) + "\n";
+  }
+  return result;
+}
+
+
+inline bool ssybc::BlockchainCheckpoints::SaveToFileAtPath(std::string const &file_path) const
+{
+  std::ofstream file{ file_path, std::ios::out | std::ios::trunc };
+  file << Text();
+  return static_cast<bool>(file);
+}
+
+
+inline auto ssybc::BlockchainCheckpoints::LoadFromFileAtPath(std::string const &file_path) -> BlockchainCheckpoints
+{
+  std::ifstream file{ file_path };
+  if (!file) {
+    return BlockchainCheckpoints{};
+  }
+  std::ostringstream text_stream{};
+  text_stream << file.rdbuf();
+  return BlockchainCheckpoints{ text_stream.str() };
+}
+
+
+inline std::string ssybc::BlockchainCheckpoints::SidecarFilePath(std::string const &chain_file_path)
+{
+  return chain_file_path + kCheckpointsFileExtension;
+}
+
+
+#endif  // SSYBC_SRC_BLOCKCHAIN_BLOCKCHAIN_CHECKPOINTS_BLOCKCHAIN_CHECKPOINTS_IMPL_HPP_
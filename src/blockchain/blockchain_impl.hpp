@@ -30,6 +30,10 @@
 #include <exception>
 #include <iterator>
 #include <algorithm>
+#include <fstream>
+#include <future>
+#include <atomic>
+#include <stdexcept>
 
 
 // --------------------------------------------- Constructor & Destructor ---------------------------------------------
@@ -53,7 +57,7 @@ template<
   ssybc::HashDifficulty Difficulty,
   template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
 ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::Blockchain(BinaryData const &binary_data):
-  Blockchain(BinaryData(binary_data.begin(), binary_data.end()))
+  Blockchain(binary_data, BlockchainCheckpoints{})
 { EMPTY_BLOCK }
 
 
@@ -61,39 +65,70 @@ template<
   typename BlockT,
   ssybc::HashDifficulty Difficulty,
   template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
-ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::Blockchain(BinaryData &&binary_data)
+ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::Blockchain(BinaryData &&binary_data):
+  Blockchain(static_cast<BinaryData const &>(binary_data))
+{ EMPTY_BLOCK }
+
+
+template<
+  typename BlockT,
+  ssybc::HashDifficulty Difficulty,
+  template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
+ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::Blockchain(std::istream &stream):
+  Blockchain(stream, BlockchainCheckpoints{})
+{ EMPTY_BLOCK }
+
+
+template<
+  typename BlockT,
+  ssybc::HashDifficulty Difficulty,
+  template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
+ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::Blockchain(
+  BinaryData const &binary_data,
+  std::shared_ptr<MiningThreadPool> const &thread_pool_ptr):
+  Blockchain(binary_data, thread_pool_ptr, BlockchainCheckpoints{})
+{ EMPTY_BLOCK }
+
+
+template<
+  typename BlockT,
+  ssybc::HashDifficulty Difficulty,
+  template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
+ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::Blockchain(
+  BinaryData const &binary_data,
+  BlockchainCheckpoints const &checkpoints)
 {
-  auto converter = BinaryDataConverterDefault<SizeT>();
-  std::vector<BlockType> blocks{};
-  while (binary_data.size() > 0) {
-    auto data_size_begin_iter = binary_data.begin();
-    std::advance(data_size_begin_iter, BlockType::BlockHeaderType::SizeOfBinary());
-    auto data_size_end_iter = data_size_begin_iter;
-    std::advance(data_size_end_iter, sizeof(SizeT));
-    BinaryData data_size_binary{ data_size_begin_iter, data_size_end_iter };
-    auto const data_size = converter.DataFromBinaryData(data_size_binary);
-    auto block_end_iter = data_size_end_iter;
-    std::advance(block_end_iter, data_size);
+  BlockStreamReader<BlockType> reader{ binary_data };
+  AppendBlocksFromReader_(reader, checkpoints);
+}
 
-    auto block_binary_copy = BinaryData{ binary_data.begin(), block_end_iter };
-    blocks.push_back(BlockType(std::move(block_binary_copy)));
-    binary_data.erase(binary_data.begin(), block_end_iter);
-  }
-  if (!ValidatorType().IsValidGenesisBlock(blocks.front())) {
-    throw std::logic_error("Cannot construct Blockchain with invalid Genesis Block.");
-  }
-  PushBackBlock_(blocks.front());
-  auto cur_iter = blocks.begin();
-  std::advance(cur_iter, 1);
-  while (cur_iter != blocks.end()) {
-    bool const append_succeed{ Append(*cur_iter) };
-    if (!append_succeed) {
-      throw std::logic_error(
-        "Cannot construct Blockchain from binary data."
-      );
-    }
-    std::advance(cur_iter, 1);
+
+template<
+  typename BlockT,
+  ssybc::HashDifficulty Difficulty,
+  template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
+ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::Blockchain(
+  std::istream &stream,
+  BlockchainCheckpoints const &checkpoints)
+{
+  BlockStreamReader<BlockType> reader{ stream };
+  AppendBlocksFromReader_(reader, checkpoints);
+}
+
+
+template<
+  typename BlockT,
+  ssybc::HashDifficulty Difficulty,
+  template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
+ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::Blockchain(
+  BinaryData const &binary_data,
+  std::shared_ptr<MiningThreadPool> const &thread_pool_ptr,
+  BlockchainCheckpoints const &checkpoints)
+{
+  if (!thread_pool_ptr) {
+    throw std::invalid_argument("Cannot load Blockchain on a null thread pool.");
   }
+  AppendBlocksInParallel_(binary_data, *thread_pool_ptr, checkpoints);
 }
 
 
@@ -139,13 +174,59 @@ inline void ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::SetMiner(C
 }
 
 
+template<
+  typename BlockT,
+  ssybc::HashDifficulty Difficulty,
+  template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
+inline void ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::SetMinerPtr(
+  std::shared_ptr<MinerType> const & miner_ptr)
+{
+  if (!miner_ptr) {
+    throw std::invalid_argument("Cannot set a null miner.");
+  }
+  miner_ptr_ = miner_ptr;
+}
+
+
+template<
+  typename BlockT,
+  ssybc::HashDifficulty Difficulty,
+  template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
+inline void ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::SetMinerByName(std::string const & miner_name)
+{
+  SetMinerPtr(MinerRegistry<ValidatorType>::Default().Create(miner_name));
+}
+
+
+template<
+  typename BlockT,
+  ssybc::HashDifficulty Difficulty,
+  template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
+inline auto ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::ValidationCachePtr() const
+  -> std::shared_ptr<ValidationCacheType>
+{
+  return validation_cache_ptr_;
+}
+
+
+template<
+  typename BlockT,
+  ssybc::HashDifficulty Difficulty,
+  template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
+inline void ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::SetValidationCachePtr(
+  std::shared_ptr<ValidationCacheType> const & cache_ptr)
+{
+  validation_cache_ptr_ = cache_ptr;
+}
+
+
 template<
   typename BlockT,
   ssybc::HashDifficulty Difficulty,
   template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
 inline bool ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::Append(BlockType const & block)
 {
-  if (ValidatorType().IsValidToAppend(TailBlock(), block)) {
+  if (Validator_().IsValidToAppend(blocks_.back(), block)) {
     PushBackBlock_(block);
     return true;
   }
@@ -160,6 +241,7 @@ template<
 inline auto ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::BlockchainHeadersOnly() const -> Blockchain
 {
   Blockchain result{ BlockT{ GenesisBlock().Header() } };
+  result.SetValidationCachePtr(validation_cache_ptr_);
   for (size_t i{ 1 }; i < blocks_.size(); ++i) {
     result.Append(BlockT(blocks_[i].Header()));
   }
@@ -167,6 +249,54 @@ inline auto ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::Blockchain
 }
 
 
+template<
+  typename BlockT,
+  ssybc::HashDifficulty Difficulty,
+  template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
+inline auto ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::TailCheckpoint() const -> BlockchainCheckpoints
+{
+  auto const tail_header = TailBlock().Header();
+  BlockchainCheckpoints result{};
+  result.Add(tail_header.Index(), tail_header.Hash());
+  return result;
+}
+
+
+template<
+  typename BlockT,
+  ssybc::HashDifficulty Difficulty,
+  template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
+inline bool ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::Verify() const
+{
+  ValidatorType const validator{};
+  for (std::size_t i{ 0 }; i < blocks_.size(); ++i) {
+    auto const &block = blocks_[i];
+    auto const header = block.Header();
+    if (HeaderHashCalculatorType().Hash(header.Binary()) != header.Hash()) {
+      return false;
+    }
+    if (!block.IsHeaderOnly() && block.Content().Hash() != header.MerkleRoot()) {
+      return false;
+    }
+    if (i == 0 ? !validator.IsValidGenesisBlock(block) : !validator.IsValidToAppend(blocks_[i - 1], block)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+template<
+  typename BlockT,
+  ssybc::HashDifficulty Difficulty,
+  template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
+inline auto ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::VerifyAsync() const -> std::future<bool>
+{
+  auto const chain_ptr = std::make_shared<Blockchain const>(*this);
+  return std::async(std::launch::async, [chain_ptr]() { return chain_ptr->Verify(); });
+}
+
+
 template<
   typename BlockT,
   ssybc::HashDifficulty Difficulty,
@@ -184,6 +314,71 @@ inline bool ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::Append(Blo
 }
 
 
+template<
+  typename BlockT,
+  ssybc::HashDifficulty Difficulty,
+  template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
+inline auto ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::AppendBlocks(
+  std::vector<BlockType> const & blocks) -> SizeT
+{
+  auto const valid_count = Validator_().FirstInvalidIndex(blocks_.back(), blocks);
+  for (SizeT i{ 0 }; i < valid_count; ++i) {
+    PushBackBlock_(blocks[i]);
+  }
+  return valid_count;
+}
+
+
+template<
+  typename BlockT,
+  ssybc::HashDifficulty Difficulty,
+  template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
+inline auto ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::AppendBlocks(
+  std::vector<BlockType> const & blocks,
+  MiningThreadPool & thread_pool) -> SizeT
+{
+  auto const valid_count = Validator_().FirstInvalidIndex(blocks_.back(), blocks, thread_pool);
+  for (SizeT i{ 0 }; i < valid_count; ++i) {
+    PushBackBlock_(blocks[i]);
+  }
+  return valid_count;
+}
+
+
+template<
+  typename BlockT,
+  ssybc::HashDifficulty Difficulty,
+  template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
+inline auto ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::MineAsync(
+  BlockDataType const & data) const -> MiningJob<BlockType>
+{
+  return MineAsync(data, std::chrono::steady_clock::time_point::max());
+}
+
+
+template<
+  typename BlockT,
+  ssybc::HashDifficulty Difficulty,
+  template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
+inline auto ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::MineAsync(
+  BlockDataType const & data,
+  std::chrono::steady_clock::time_point const deadline) const -> MiningJob<BlockType>
+{
+  auto const tail_block = TailBlock();
+  auto const next_block_init = BlockInitializedWithData_(
+    data,
+    tail_block.Header().Version(),
+    blocks_.size(),
+    tail_block.Header().Hash());
+  auto const session_ptr = std::make_shared<MiningSession>(deadline);
+  auto const miner_ptr = MinerPtr();
+  auto future = std::async(std::launch::async, [miner_ptr, session_ptr, tail_block, next_block_init] {
+    return miner_ptr->Mine(tail_block, next_block_init, *session_ptr);
+  });
+  return MiningJob<BlockType>{ session_ptr, std::move(future) };
+}
+
+
 template<
   typename BlockT,
   ssybc::HashDifficulty Difficulty,
@@ -224,8 +419,7 @@ template<
   template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
 inline BlockT ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::operator[](std::string const &hash_string)
 {
-  std::size_t index = hash_to_index_dict_[hash_string];
-  return (*this)[index];
+  return (*this)[BlockHash(util::BytesFromHexString(hash_string))];
 }
 
 
@@ -233,10 +427,10 @@ template<
   typename BlockT,
   ssybc::HashDifficulty Difficulty,
   template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
-inline BlockT ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::operator[](BinaryData const &hash)
+inline BlockT ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::operator[](BlockHash const &hash)
 {
-  auto hash_string = util::HexStringFromBytes(hash);
-  return (*this)[hash_string];
+  std::size_t index = hash_to_index_dict_[hash];
+  return (*this)[index];
 }
 
 
@@ -341,6 +535,18 @@ inline bool ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::SaveBinary
 }
 
 
+template<
+  typename BlockT,
+  ssybc::HashDifficulty Difficulty,
+  template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
+inline bool ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::SaveBinaryAndCheckpointToFileAtPath(
+  std::string const & file_path)
+{
+  return SaveBinaryToFileAtPath(file_path)
+    && TailCheckpoint().SaveToFileAtPath(BlockchainCheckpoints::SidecarFilePath(file_path));
+}
+
+
 template<
   typename BlockT,
   ssybc::HashDifficulty Difficulty,
@@ -363,13 +569,87 @@ inline auto ssybc::Blockchain<
   Difficulty,
   ValidatorTemplate>::LoadFromBinaryFileAtPath(std::string const & file_path) -> Blockchain
 {
-  return Blockchain{ util::ReadBinaryDataFromFileAtPath(file_path) };
+  std::ifstream file{ file_path, std::ios::in | std::ios::binary };
+  if (!file) {
+    throw std::runtime_error("Cannot open blockchain file \"" + file_path + "\".");
+  }
+  return Blockchain{ file };
+}
+
+
+template<
+  typename BlockT,
+  ssybc::HashDifficulty Difficulty,
+  template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
+inline auto ssybc::Blockchain<
+  BlockT,
+  Difficulty,
+  ValidatorTemplate>::LoadFromBinaryFileAtPath(
+    std::string const & file_path,
+    BlockchainCheckpoints const & checkpoints) -> Blockchain
+{
+  std::ifstream file{ file_path, std::ios::in | std::ios::binary };
+  if (!file) {
+    throw std::runtime_error("Cannot open blockchain file \"" + file_path + "\".");
+  }
+  return Blockchain{ file, checkpoints };
+}
+
+
+template<
+  typename BlockT,
+  ssybc::HashDifficulty Difficulty,
+  template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
+inline auto ssybc::Blockchain<
+  BlockT,
+  Difficulty,
+  ValidatorTemplate>::LoadFromBinaryFileAtPathWithCheckpoints(std::string const & file_path) -> Blockchain
+{
+  return LoadFromBinaryFileAtPath(
+    file_path,
+    BlockchainCheckpoints::LoadFromFileAtPath(BlockchainCheckpoints::SidecarFilePath(file_path)));
+}
+
+
+template<
+  typename BlockT,
+  ssybc::HashDifficulty Difficulty,
+  template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
+inline auto ssybc::Blockchain<
+  BlockT,
+  Difficulty,
+  ValidatorTemplate>::LoadFromBinaryFileAtPath(
+    std::string const & file_path,
+    std::shared_ptr<MiningThreadPool> const & thread_pool_ptr) -> Blockchain
+{
+  std::ifstream file{ file_path, std::ios::in | std::ios::binary | std::ios::ate };
+  if (!file) {
+    throw std::runtime_error("Cannot open blockchain file \"" + file_path + "\".");
+  }
+  BinaryData binary_data(static_cast<std::size_t>(file.tellg()));
+  file.seekg(0, std::ios::beg);
+  if (!file.read(reinterpret_cast<char *>(binary_data.data()), static_cast<std::streamsize>(binary_data.size()))) {
+    throw std::runtime_error("Cannot read blockchain file \"" + file_path + "\".");
+  }
+  return Blockchain{ binary_data, thread_pool_ptr };
 }
 
 
 // -------------------------------------------------- Private Member --------------------------------------------------
 
 
+template<
+  typename BlockT,
+  ssybc::HashDifficulty Difficulty,
+  template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
+inline auto ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::Validator_() const -> ValidatorType
+{
+  ValidatorType result{};
+  result.SetValidationCachePtr(validation_cache_ptr_);
+  return result;
+}
+
+
 template<
   typename BlockT,
   ssybc::HashDifficulty Difficulty,
@@ -377,7 +657,181 @@ template<
 inline void ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::PushBackBlock_(BlockType const & block)
 {
   blocks_.push_back(block);
-  hash_to_index_dict_[block.Header().HashAsString()] = static_cast<std::size_t>(block.Header().Index());
+  hash_to_index_dict_[block.Header().Hash()] = static_cast<std::size_t>(block.Header().Index());
+}
+
+
+template<
+  typename BlockT,
+  ssybc::HashDifficulty Difficulty,
+  template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
+inline void ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::PushBackBlock_(BlockType && block)
+{
+  hash_to_index_dict_[block.Header().Hash()] = static_cast<std::size_t>(block.Header().Index());
+  blocks_.push_back(std::move(block));
+}
+
+
+// Headers are independent messages of the same size, every batch of them is hashed at once so multi-buffer SIMD
+// kernels get full lanes, instead of one at a time while each block is constructed. Only one batch of block binaries
+// is held besides the chain itself.
+template<
+  typename BlockT,
+  ssybc::HashDifficulty Difficulty,
+  template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
+inline void ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::AppendBlocksFromReader_(
+  BlockStreamReader<BlockType> & reader,
+  BlockchainCheckpoints const & checkpoints)
+{
+  auto const size_of_header = static_cast<std::ptrdiff_t>(BlockType::BlockHeaderType::SizeOfBinary());
+  std::vector<BinaryData> block_binaries(static_cast<std::size_t>(kBlockLoadingBatchSize));
+  std::vector<BinaryData> header_binaries{};
+  header_binaries.reserve(static_cast<std::size_t>(kBlockLoadingBatchSize));
+  bool is_at_end{ false };
+  while (!is_at_end) {
+    std::size_t block_count{ 0 };
+    header_binaries.clear();
+    while (block_count < block_binaries.size() && reader.NextBlockBinary(block_binaries[block_count])) {
+      auto const &block_binary = block_binaries[block_count];
+      header_binaries.push_back(BinaryData{ block_binary.begin(), block_binary.begin() + size_of_header });
+      ++block_count;
+    }
+    is_at_end = block_count < block_binaries.size();
+
+    auto const header_hashes = HeaderHashCalculatorType().HashBatch(header_binaries);
+    for (std::size_t i{ 0 }; i < block_count; ++i) {
+      auto const height = static_cast<BlockIndex>(blocks_.size());
+      BlockType const block{ std::move(block_binaries[i]), header_hashes[i], !checkpoints.Covers(height) };
+      if (!checkpoints.IsConsistentWith(height, header_hashes[i])) {
+        throw std::logic_error("Cannot construct Blockchain from binary data not matching its checkpoints.");
+      }
+      if (blocks_.empty()) {
+        if (!ValidatorType().IsValidGenesisBlock(block)) {
+          throw std::logic_error("Cannot construct Blockchain with invalid Genesis Block.");
+        }
+        PushBackBlock_(block);
+      } else if (!Append(block)) {
+        throw std::logic_error("Cannot construct Blockchain from binary data.");
+      }
+    }
+  }
+  if (blocks_.empty()) {
+    throw std::logic_error("Cannot construct Blockchain from binary data without blocks.");
+  }
+  ThrowIfBelowHighestCheckpoint_(checkpoints);
+}
+
+
+// Everything but the linkage between neighbours only depends on the block itself: workers take chunks of blocks,
+// hash their headers in one batch, check the merkle root while constructing them and check the proof of work against
+// the previous hash stored in the header. The last pass only compares indices, time stamps and hashes.
+template<
+  typename BlockT,
+  ssybc::HashDifficulty Difficulty,
+  template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
+inline void ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::AppendBlocksInParallel_(
+  BinaryData const & binary_data,
+  MiningThreadPool & thread_pool,
+  BlockchainCheckpoints const & checkpoints)
+{
+  std::vector<SizeT> block_offsets{};
+  std::vector<SizeT> block_sizes{};
+  BlockStreamReader<BlockType> reader{ binary_data };
+  SizeT block_offset{ 0 };
+  SizeT block_size{ 0 };
+  while (reader.NextBlockExtent(block_offset, block_size)) {
+    block_offsets.push_back(block_offset);
+    block_sizes.push_back(block_size);
+  }
+  auto const block_count = static_cast<SizeT>(block_offsets.size());
+  if (block_count == 0) {
+    throw std::logic_error("Cannot construct Blockchain from binary data without blocks.");
+  }
+
+  auto const size_of_header = BlockType::BlockHeaderType::SizeOfBinary();
+  auto const bytes = binary_data.data();
+  std::vector<std::unique_ptr<BlockType>> block_ptrs(static_cast<std::size_t>(block_count));
+  std::atomic<SizeT> next_block_index{ 0 };
+  std::atomic<SizeT> first_invalid_index{ block_count };
+  auto const invalidate = [&first_invalid_index](SizeT const index) {
+    auto current = first_invalid_index.load();
+    while (index < current && !first_invalid_index.compare_exchange_weak(current, index)) { EMPTY_BLOCK }
+  };
+
+  thread_pool.Run([&](SizeT const) {
+    ValidatorType const validator{};
+    std::vector<BinaryData> header_binaries{};
+    header_binaries.reserve(static_cast<std::size_t>(kParallelBlockLoadingChunkSize));
+    while (true) {
+      auto const chunk_begin = next_block_index.fetch_add(kParallelBlockLoadingChunkSize);
+      if (chunk_begin >= block_count || chunk_begin >= first_invalid_index.load()) {
+        return;
+      }
+      auto const chunk_end = std::min(chunk_begin + kParallelBlockLoadingChunkSize, block_count);
+      header_binaries.clear();
+      for (SizeT i{ chunk_begin }; i < chunk_end; ++i) {
+        header_binaries.push_back(BinaryData{ bytes + block_offsets[i], bytes + block_offsets[i] + size_of_header });
+      }
+      auto const header_hashes = HeaderHashCalculatorType().HashBatch(header_binaries);
+      for (SizeT i{ chunk_begin }; i < chunk_end; ++i) {
+        bool is_valid{ false };
+        try {
+          // Not std::make_unique, this constructor of Block is only accessible to Blockchain.
+          block_ptrs[i].reset(new BlockType(
+            BinaryData{ bytes + block_offsets[i], bytes + block_offsets[i] + block_sizes[i] },
+            header_hashes[i - chunk_begin],
+            !checkpoints.Covers(i)));
+          auto const &header = block_ptrs[i]->Header();
+          is_valid = i == 0
+            ? validator.IsValidGenesisBlock(*block_ptrs[i])
+            : validator.IsValidHashToAppend(header.PreviousHash(), header.Hash());
+        } catch (std::exception const &) {
+          is_valid = false;
+        }
+        if (!is_valid) {
+          invalidate(i);
+          return;
+        }
+      }
+    }
+  });
+
+  auto const invalid_index = first_invalid_index.load();
+  if (invalid_index == 0) {
+    throw std::logic_error("Cannot construct Blockchain with invalid Genesis Block.");
+  }
+  if (invalid_index < block_count) {
+    throw std::logic_error("Cannot construct Blockchain from binary data.");
+  }
+
+  ValidatorType const validator{};
+  blocks_.reserve(static_cast<std::size_t>(block_count));
+  for (SizeT i{ 0 }; i < block_count; ++i) {
+    if (!checkpoints.IsConsistentWith(i, block_ptrs[i]->Header().Hash())) {
+      throw std::logic_error("Cannot construct Blockchain from binary data not matching its checkpoints.");
+    }
+    if (i > 0 && !validator.IsBlockPreAdjacentTo(blocks_.back(), *block_ptrs[i])) {
+      throw std::logic_error("Cannot construct Blockchain from binary data.");
+    }
+    PushBackBlock_(std::move(*block_ptrs[i]));
+    block_ptrs[i].reset();
+  }
+  ThrowIfBelowHighestCheckpoint_(checkpoints);
+}
+
+
+// Blocks below a checkpoint are only vouched for by the checkpoint's header hash, data ending before it has nothing
+// to vouch for the content that was not checked.
+template<
+  typename BlockT,
+  ssybc::HashDifficulty Difficulty,
+  template<typename, ssybc::HashDifficulty> class ValidatorTemplate>
+inline void ssybc::Blockchain<BlockT, Difficulty, ValidatorTemplate>::ThrowIfBelowHighestCheckpoint_(
+  BlockchainCheckpoints const & checkpoints) const
+{
+  if (checkpoints.Covers(static_cast<BlockIndex>(blocks_.size()))) {
+    throw std::logic_error("Cannot construct Blockchain from binary data ending below its highest checkpoint.");
+  }
 }
 
 
@@ -390,7 +844,7 @@ BlockT ssybc::Blockchain<
   Difficulty,
   ValidatorTemplate>::GenesisBlockMinedWithData(BlockDataType const & data)
 {
-  return GenesisBlockMinedWithData(data, DefaultMiner_());
+  return GenesisBlockMinedWithData(data, BlockMinerCPUBruteForce<ValidatorType>(MiningThreadPool::Default()));
 }
 
 
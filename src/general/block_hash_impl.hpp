@@ -0,0 +1,230 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_SRC_GENERAL_BLOCK_HASH_IMPL_HPP_
+#define SSYBC_SRC_GENERAL_BLOCK_HASH_IMPL_HPP_
+
+#include "include/ssybc/general/block_hash.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+
+static_assert(std::is_trivially_copyable<ssybc::BlockHash>::value, "BlockHash must be trivially copyable.");
+static_assert(sizeof(ssybc::BlockHash) == ssybc::kSizeOfBlockHashInBytes, "BlockHash must not have padding.");
+
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+
+inline ssybc::BlockHash::BlockHash():
+  bytes_{}
+{ EMPTY_BLOCK }
+
+
+inline ssybc::BlockHash::BlockHash(Byte const * data, SizeT const size)
+{
+  if (size != kSizeOfBlockHashInBytes) {
+    throw std::invalid_argument(
+      "Cannot construct BlockHash from " + std::to_string(size) + " bytes, expected "
+      + std::to_string(kSizeOfBlockHashInBytes) + ".");
+  }
+  std::memcpy(bytes_, data, kSizeOfBlockHashInBytes);
+}
+
+
+inline ssybc::BlockHash::BlockHash(BinaryData const & binary_data):
+  BlockHash(binary_data.data(), binary_data.size())
+{ EMPTY_BLOCK }
+
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+
+inline auto ssybc::BlockHash::data() -> Byte *
+{
+  return bytes_;
+}
+
+
+inline auto ssybc::BlockHash::data() const -> Byte const *
+{
+  return bytes_;
+}
+
+
+inline auto ssybc::BlockHash::begin() -> iterator
+{
+  return bytes_;
+}
+
+
+inline auto ssybc::BlockHash::end() -> iterator
+{
+  return bytes_ + kSizeOfBlockHashInBytes;
+}
+
+
+inline auto ssybc::BlockHash::begin() const -> const_iterator
+{
+  return bytes_;
+}
+
+
+inline auto ssybc::BlockHash::end() const -> const_iterator
+{
+  return bytes_ + kSizeOfBlockHashInBytes;
+}
+
+
+inline auto ssybc::BlockHash::operator[](std::size_t const index) -> Byte &
+{
+  return bytes_[index];
+}
+
+
+inline auto ssybc::BlockHash::operator[](std::size_t const index) const -> Byte const &
+{
+  return bytes_[index];
+}
+
+
+inline auto ssybc::BlockHash::Binary() const -> BinaryData
+{
+  return BinaryData(begin(), end());
+}
+
+
+inline int ssybc::BlockHash::Compare(BlockHash const & hash) const
+{
+  for (std::size_t i{ 0 }; i < kSizeOfBlockHashInBytes / sizeof(std::uint64_t); ++i) {
+    auto const lhs_word = BigEndianWord_(i);
+    auto const rhs_word = hash.BigEndianWord_(i);
+    if (lhs_word != rhs_word) {
+      return lhs_word < rhs_word ? -1 : 1;
+    }
+  }
+  return 0;
+}
+
+
+inline auto ssybc::BlockHash::LeadingZeroBits() const -> SizeT
+{
+  SizeT result{ 0 };
+  std::uint64_t is_zero_so_far{ 1 };
+  for (std::size_t i{ 0 }; i < kSizeOfBlockHashInBytes / sizeof(std::uint64_t); ++i) {
+    auto const word = BigEndianWord_(i);
+    result += is_zero_so_far * CountLeadingZeros_(word);
+    is_zero_so_far &= static_cast<std::uint64_t>(word == 0);
+  }
+  return result;
+}
+
+
+inline bool ssybc::BlockHash::operator==(BlockHash const & hash) const
+{
+  return ((Word_(0) ^ hash.Word_(0)) | (Word_(1) ^ hash.Word_(1))
+    | (Word_(2) ^ hash.Word_(2)) | (Word_(3) ^ hash.Word_(3))) == 0;
+}
+
+
+inline bool ssybc::BlockHash::operator!=(BlockHash const & hash) const
+{
+  return !((*this) == hash);
+}
+
+
+inline bool ssybc::BlockHash::operator<(BlockHash const & hash) const
+{
+  return Compare(hash) < 0;
+}
+
+
+inline bool ssybc::BlockHash::operator<=(BlockHash const & hash) const
+{
+  return Compare(hash) <= 0;
+}
+
+
+inline bool ssybc::BlockHash::operator>(BlockHash const & hash) const
+{
+  return Compare(hash) > 0;
+}
+
+
+inline bool ssybc::BlockHash::operator>=(BlockHash const & hash) const
+{
+  return Compare(hash) >= 0;
+}
+
+
+// -------------------------------------------------- Private Method --------------------------------------------------
+
+
+inline std::uint64_t ssybc::BlockHash::Word_(std::size_t const index) const
+{
+  std::uint64_t result;
+  std::memcpy(&result, bytes_ + index * sizeof(std::uint64_t), sizeof(std::uint64_t));
+  return result;
+}
+
+
+// Compilers turn this into one load and a byte swap on little-endian CPUs.
+inline std::uint64_t ssybc::BlockHash::BigEndianWord_(std::size_t const index) const
+{
+  std::uint64_t result{ 0 };
+  for (std::size_t i{ 0 }; i < sizeof(std::uint64_t); ++i) {
+    result = (result << kNumberOfBitsInByte) | bytes_[index * sizeof(std::uint64_t) + i];
+  }
+  return result;
+}
+
+
+inline std::uint64_t ssybc::BlockHash::CountLeadingZeros_(std::uint64_t const word)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  // Setting the lowest bit keeps the argument non-zero, it only matters when all the other bits are zero.
+  return static_cast<std::uint64_t>(__builtin_clzll(word | 1)) + static_cast<std::uint64_t>(word == 0);
+#else
+  std::uint64_t result{ 0 };
+  for (std::uint64_t mask{ std::uint64_t{ 1 } << 63 }; mask != 0 && (word & mask) == 0; mask >>= 1) {
+    ++result;
+  }
+  return result;
+#endif
+}
+
+
+// ------------------------------------------------------- Hash -------------------------------------------------------
+
+
+// Block hashes are already uniformly distributed, any one word of them is a good bucket hash.
+inline std::size_t std::hash<ssybc::BlockHash>::operator()(ssybc::BlockHash const & hash) const
+{
+  std::size_t result;
+  std::memcpy(&result, hash.data(), sizeof(std::size_t));
+  return result;
+}
+
+
+#endif  // SSYBC_SRC_GENERAL_BLOCK_HASH_IMPL_HPP_
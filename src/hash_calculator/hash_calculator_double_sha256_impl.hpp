@@ -23,9 +23,10 @@
 
 
 #include "include/ssybc/hash_calculator/hash_calculator_double_sha256.hpp"
+#include "include/ssybc/hash_calculator/hash_calculator_sha256_midstate.hpp"
 #include "include/ssybc/hash_calculator/hash_calculator_sha256.hpp"
-#include "include/ssybc/binary_data_converter/binary_data_converter_default.hpp"
 #include "include/ssybc/utility/utility.hpp"
+#include "library/sha256/sha256.hpp"
 
 
 auto ssybc::DoubleSHA256Calculator::SizeOfHashInBytes() const -> SizeT
@@ -40,14 +41,59 @@ ssybc::BlockHash ssybc::DoubleSHA256Calculator::GenesisBlockPreviousHash() const
 }
 
 
+inline std::string ssybc::DoubleSHA256Calculator::BackendName()
+{
+  return SHA256Calculator::BackendName();
+}
+
+
+inline std::string ssybc::DoubleSHA256Calculator::BatchBackendName()
+{
+  return SHA256Calculator::BatchBackendName();
+}
+
+
 ssybc::BlockHash ssybc::DoubleSHA256Calculator::Hash(ssybc::BinaryData const data) const
 {
-  BlockHash const first_level_hash{ SHA256Calculator().Hash(data) };
-  BinaryData const binary_hash{ BinaryDataConverterDefault<BlockHash>().BinaryDataFromData(first_level_hash) };
-  BlockHash const result{ SHA256Calculator().Hash(binary_hash) };
+  BlockHash result;
+  HashInto(data.data(), data.size(), result);
   return result;
 }
 
 
+inline void ssybc::DoubleSHA256Calculator::HashInto(Byte const * data, SizeT const size, BlockHash & hash) const
+{
+  sha256d(data, static_cast<std::size_t>(size), hash.data());
+}
+
+
+inline void ssybc::DoubleSHA256Calculator::HashBatchInto(
+  Byte const * const messages[],
+  SizeT const count,
+  SizeT const size,
+  BlockHash hashes[]) const
+{
+  static_assert(sizeof(BlockHash) == SHA256_BLOCK_SIZE, "BlockHash must be layout compatible with a SHA-256 digest.");
+  sha256d_multi(
+    messages,
+    static_cast<std::size_t>(count),
+    static_cast<std::size_t>(size),
+    reinterpret_cast<BYTE (*)[SHA256_BLOCK_SIZE]>(hashes));
+}
+
+
+inline auto ssybc::DoubleSHA256Calculator::BatchLaneCount() const -> SizeT
+{
+  return SHA256Calculator().BatchLaneCount();
+}
+
+
+inline auto ssybc::DoubleSHA256Calculator::CalculatorWithFixedPrefix(
+  BinaryData const & prefix) const -> std::unique_ptr<HashCalculatorInterface const>
+{
+  return std::make_unique<SHA256MidstateCalculator const>(prefix, true);
+}
+
+
 #endif  // SSYBC_SRC_HASH_CALCULATOR_HASH_CALCULATOR_DOUBLE_SHA256_IMPL_HPP_
 
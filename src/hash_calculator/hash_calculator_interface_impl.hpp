@@ -0,0 +1,92 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+
+#ifndef SSYBC_SRC_HASH_CALCULATOR_HASH_CALCULATOR_INTERFACE_IMPL_HPP_
+#define SSYBC_SRC_HASH_CALCULATOR_HASH_CALCULATOR_INTERFACE_IMPL_HPP_
+
+
+#include "include/ssybc/hash_calculator/hash_calculator_interface.hpp"
+
+#include <algorithm>
+
+
+inline void ssybc::HashCalculatorInterface::HashInto(Byte const * data, SizeT const size, BlockHash & hash) const
+{
+  hash = Hash(BinaryData(data, data + size));
+}
+
+
+inline void ssybc::HashCalculatorInterface::HashBatchInto(
+  Byte const * const messages[],
+  SizeT const count,
+  SizeT const size,
+  BlockHash hashes[]) const
+{
+  for (SizeT i{ 0 }; i < count; ++i) {
+    HashInto(messages[i], size, hashes[i]);
+  }
+}
+
+
+inline auto ssybc::HashCalculatorInterface::BatchLaneCount() const -> SizeT
+{
+  return 1;
+}
+
+
+inline auto ssybc::HashCalculatorInterface::HashBatch(
+  std::vector<BinaryData> const & data) const -> std::vector<BlockHash>
+{
+  std::vector<BlockHash> result{};
+  if (data.empty()) {
+    return result;
+  }
+  result.reserve(data.size());
+  SizeT const message_size{ data.front().size() };
+  bool const is_uniform_size{ std::all_of(data.begin(), data.end(), [&](BinaryData const &message) {
+    return message.size() == message_size;
+  }) };
+  if (!is_uniform_size) {
+    for (auto const &message : data) {
+      result.push_back(Hash(message));
+    }
+    return result;
+  }
+
+  std::vector<Byte const *> messages{};
+  messages.reserve(data.size());
+  for (auto const &message : data) {
+    messages.push_back(message.data());
+  }
+  result.resize(data.size());
+  HashBatchInto(messages.data(), messages.size(), message_size, result.data());
+  return result;
+}
+
+
+inline auto ssybc::HashCalculatorInterface::CalculatorWithFixedPrefix(
+  BinaryData const &) const -> std::unique_ptr<HashCalculatorInterface const>
+{
+  return nullptr;
+}
+
+
+#endif  // SSYBC_SRC_HASH_CALCULATOR_HASH_CALCULATOR_INTERFACE_IMPL_HPP_
@@ -24,9 +24,12 @@
 
 
 #include "include/ssybc/hash_calculator/hash_calculator_sha256.hpp"
+#include "include/ssybc/hash_calculator/hash_calculator_sha256_midstate.hpp"
 #include "include/ssybc/utility/utility.hpp"
 #include "library/sha256/sha256.hpp"
 
+#include <algorithm>
+
 
 auto ssybc::SHA256Calculator::SizeOfHashInBytes() const -> SizeT
 {
@@ -36,23 +39,61 @@ auto ssybc::SHA256Calculator::SizeOfHashInBytes() const -> SizeT
 
 ssybc::BlockHash ssybc::SHA256Calculator::GenesisBlockPreviousHash() const
 {
-  return BinaryData(SizeOfHashInBytes());
+  return BlockHash();
+}
+
+
+inline std::string ssybc::SHA256Calculator::BackendName()
+{
+  return std::string(sha256_backend_name());
+}
+
+
+inline std::string ssybc::SHA256Calculator::BatchBackendName()
+{
+  return std::string(sha256_multi_backend_name());
 }
 
 
 ssybc::BlockHash ssybc::SHA256Calculator::Hash(ssybc::BinaryData const data) const
 {
-  SizeT const data_size{data.size()};
-  Byte const * data_ptr{ &data.front() };
+  BlockHash result;
+  HashInto(data.data(), data.size(), result);
+  return result;
+}
+
+
+inline void ssybc::SHA256Calculator::HashInto(Byte const * data, SizeT const size, BlockHash & hash) const
+{
+  sha256(data, static_cast<std::size_t>(size), hash.data());
+}
 
-  BYTE result[SHA256_BLOCK_SIZE];
-  SHA256_CTX ctx;
 
-  sha256_init(&ctx);
-  sha256_update(&ctx, data_ptr, data_size);
-  sha256_final(&ctx, result);
+inline void ssybc::SHA256Calculator::HashBatchInto(
+  Byte const * const messages[],
+  SizeT const count,
+  SizeT const size,
+  BlockHash hashes[]) const
+{
+  static_assert(sizeof(BlockHash) == SHA256_BLOCK_SIZE, "BlockHash must be layout compatible with a SHA-256 digest.");
+  sha256_multi(
+    messages,
+    static_cast<std::size_t>(count),
+    static_cast<std::size_t>(size),
+    reinterpret_cast<BYTE (*)[SHA256_BLOCK_SIZE]>(hashes));
+}
+
 
-  return BinaryData(result, result + SHA256_BLOCK_SIZE);
+inline auto ssybc::SHA256Calculator::BatchLaneCount() const -> SizeT
+{
+  return static_cast<SizeT>(sha256_multi_lanes());
+}
+
+
+inline auto ssybc::SHA256Calculator::CalculatorWithFixedPrefix(
+  BinaryData const & prefix) const -> std::unique_ptr<HashCalculatorInterface const>
+{
+  return std::make_unique<SHA256MidstateCalculator const>(prefix, false);
 }
 
 
@@ -0,0 +1,109 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+
+#ifndef SSYBC_SRC_HASH_CALCULATOR_HASH_CALCULATOR_SHA256_MIDSTATE_IMPL_HPP_
+#define SSYBC_SRC_HASH_CALCULATOR_HASH_CALCULATOR_SHA256_MIDSTATE_IMPL_HPP_
+
+
+#include "include/ssybc/hash_calculator/hash_calculator_sha256_midstate.hpp"
+#include "include/ssybc/hash_calculator/hash_calculator_sha256.hpp"
+#include "library/sha256/sha256.hpp"
+
+#include <algorithm>
+
+
+inline ssybc::SHA256MidstateCalculator::SHA256MidstateCalculator(
+  BinaryData const & prefix,
+  bool const is_double_sha256):
+  is_double_sha256_{ is_double_sha256 },
+  prefix_size_{ prefix.size() / 64 * 64 },
+  midstate_{}
+{
+  SHA256_CTX ctx;
+  sha256_init(&ctx);
+  sha256_update(&ctx, prefix.data(), static_cast<std::size_t>(prefix_size_));
+  std::copy(ctx.state, ctx.state + 8, midstate_.begin());
+}
+
+
+inline auto ssybc::SHA256MidstateCalculator::SizeOfHashInBytes() const -> SizeT
+{
+  return SHA256_BLOCK_SIZE;
+}
+
+
+inline auto ssybc::SHA256MidstateCalculator::GenesisBlockPreviousHash() const -> BlockHash
+{
+  return SHA256Calculator().GenesisBlockPreviousHash();
+}
+
+
+inline auto ssybc::SHA256MidstateCalculator::Hash(BinaryData const data) const -> BlockHash
+{
+  BlockHash result;
+  HashInto(data.data(), data.size(), result);
+  return result;
+}
+
+
+inline void ssybc::SHA256MidstateCalculator::HashInto(Byte const * data, SizeT const size, BlockHash & hash) const
+{
+  auto const hash_function = is_double_sha256_ ? sha256d_from_state : sha256_from_state;
+  hash_function(
+    midstate_.data(),
+    static_cast<std::size_t>(prefix_size_),
+    data + prefix_size_,
+    static_cast<std::size_t>(size - prefix_size_),
+    hash.data());
+}
+
+
+inline auto ssybc::SHA256MidstateCalculator::BatchLaneCount() const -> SizeT
+{
+  return SHA256Calculator().BatchLaneCount();
+}
+
+
+inline void ssybc::SHA256MidstateCalculator::HashBatchInto(
+  Byte const * const messages[],
+  SizeT const count,
+  SizeT const size,
+  BlockHash hashes[]) const
+{
+  // Pointers past the prefix, SHA256_MAX_LANES at a time to keep them on the stack.
+  auto const hash_function = is_double_sha256_ ? sha256d_multi_from_state : sha256_multi_from_state;
+  Byte const *chunk[SHA256_MAX_LANES];
+  for (SizeT done{ 0 }; done < count; done += SHA256_MAX_LANES) {
+    auto const chunk_size = std::min<SizeT>(SHA256_MAX_LANES, count - done);
+    for (SizeT i{ 0 }; i < chunk_size; ++i) {
+      chunk[i] = messages[done + i] + prefix_size_;
+    }
+    hash_function(
+      midstate_.data(),
+      static_cast<std::size_t>(prefix_size_),
+      chunk,
+      static_cast<std::size_t>(chunk_size),
+      static_cast<std::size_t>(size - prefix_size_),
+      reinterpret_cast<BYTE (*)[SHA256_BLOCK_SIZE]>(hashes + done));
+  }
+}
+
+#endif  // SSYBC_SRC_HASH_CALCULATOR_HASH_CALCULATOR_SHA256_MIDSTATE_IMPL_HPP_
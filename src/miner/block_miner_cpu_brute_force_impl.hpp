@@ -23,70 +23,124 @@
 #define SSYBC_SRC_MINER_BLOCK_MINER_CPU_BRUTE_FORCE_IMPL_HPP_
 
 #include "include/ssybc/miner/block_miner_cpu_brute_force.hpp"
+#include "include/ssybc/miner/mining_session.hpp"
+#include "include/ssybc/miner/nonce_dispenser.hpp"
 #include "include/ssybc/validator/block_validator.hpp"
+#include "include/ssybc/hash_calculator/hash_calculator_interface.hpp"
 #include "include/ssybc/utility/utility.hpp"
 #include "include/ssybc/logging/logging.hpp"
 
+#include <algorithm>
+#include <cstdint>
 #include <exception>
+#include <memory>
 #include <typeinfo>
-#include <limits>
-#include <thread>
-#include <mutex>
-#include <condition_variable>
-
-#ifdef SSYBC_HAS_ATOMIC_FOR_CUSTOM_TYPE
-#include <atomic>
-#endif
 
 
 // ----------------------------------------------------- Helper -------------------------------------------------------
 
 namespace ssybc {
 
-  template<typename ValidatorT, typename HashCalculatorT>
-  void MineGenesisInfoOnCPUThreadBruteForce_(
-    BinaryData const & hashable_binary,
-    BlockTimeInterval const time_stamp,
-    BlockNonce const nonce_start,
-    BlockNonce const nonce_end,
-    ValidatorT const validator,
-    HashCalculatorT const hash_calculator);
-
-  template<typename ValidatorT, typename HashCalculatorT>
+  template<typename HashCalculatorT, typename HashPredicateT>
   void MineInfoOnCPUThreadBruteForce_(
-    BinaryData const & previous_hash,
+    MiningSession & session,
+    NonceDispenser & dispenser,
+    MiningStats & stats,
+    MiningThrottlePacer & pacer,
+    SizeT const worker_index,
     BinaryData const & hashable_binary,
+    HashCalculatorT const hash_calculator,
+    HashPredicateT const is_valid_hash);
+
+  constexpr SizeT kMiningCacheLineSize_{ 64 };
+
+  std::unique_ptr<NonceDispenser> NonceDispenserOfSession_(
+    MiningSession const &session,
     BlockTimeInterval const time_stamp,
-    BlockNonce const nonce_start,
-    BlockNonce const nonce_end,
-    ValidatorT const validator,
-    HashCalculatorT const hash_calculator);
-
-  static std::mutex block_mining_mtx_;
-  static std::condition_variable block_mined_cv_;
-  static bool is_block_mined_{ false };
-
-#ifdef SSYBC_HAS_ATOMIC_FOR_CUSTOM_TYPE
-  static std::atomic<MinedResult> block_result_{};
-#else
-  static MinedResult block_result_{};
-#endif
-
-  void LogThreadMiningNonceInRange_(BlockNonce const start, BlockNonce const stop);
-  void LogThreadMiningNonceInRangeTerminatedWithoutValidResult_(BlockNonce const start, BlockNonce const stop);
-  void LogThreadMiningNonceInRangeTerminatedWithValidResult_(
-    BlockNonce const start,
-    BlockNonce const stop,
-    BlockNonce const result);
+    BlockNonce const batch_size);
+
+  BinaryData MiningPrefixFromHashableBinary_(BinaryData const &hashable_binary);
+  Byte * AlignedToCacheLine_(Byte * const pointer);
+
+  void LogThreadMiningNonceBatches_(BlockNonce const batch_size);
+  void LogThreadMiningTerminatedWithoutValidResult_();
+  void LogThreadMiningTerminatedWithValidResult_(MinedResult const result);
 }
 
 
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+
+template<typename Validator>
+inline ssybc::BlockMinerCPUBruteForce<Validator>::BlockMinerCPUBruteForce():
+  BlockMinerCPUBruteForce(std::make_shared<MiningThreadPool>())
+{ EMPTY_BLOCK }
+
+
+template<typename Validator>
+inline ssybc::BlockMinerCPUBruteForce<Validator>::BlockMinerCPUBruteForce(
+  std::shared_ptr<MiningThreadPool> thread_pool_ptr):
+  BlockMinerCPUBruteForce(thread_pool_ptr, MiningThrottle{})
+{ EMPTY_BLOCK }
+
+
+template<typename Validator>
+inline ssybc::BlockMinerCPUBruteForce<Validator>::BlockMinerCPUBruteForce(
+  std::shared_ptr<MiningThreadPool> thread_pool_ptr,
+  MiningThrottle const & throttle):
+  thread_pool_ptr_{ thread_pool_ptr },
+  stats_ptr_{ std::make_shared<MiningStats>(thread_pool_ptr->Size()) },
+  throttle_{ throttle }
+{ EMPTY_BLOCK }
+
+
 // --------------------------------------------------- Public Method --------------------------------------------------
 
 
+template<typename Validator>
+inline auto ssybc::BlockMinerCPUBruteForce<Validator>::ThreadPoolPtr() const -> std::shared_ptr<MiningThreadPool>
+{
+  return thread_pool_ptr_;
+}
+
+
+template<typename Validator>
+inline auto ssybc::BlockMinerCPUBruteForce<Validator>::StatsPtr() const -> std::shared_ptr<MiningStats>
+{
+  return stats_ptr_;
+}
+
+
+template<typename Validator>
+inline auto ssybc::BlockMinerCPUBruteForce<Validator>::Throttle() const -> MiningThrottle
+{
+  return throttle_;
+}
+
+
 template<typename Validator>
 inline auto ssybc::BlockMinerCPUBruteForce<Validator>::MineGenesisInfo(
   BinaryData const & hashable_binary) const -> MinedResult
+{
+  MiningSession session{};
+  return MineGenesisInfo(hashable_binary, session);
+}
+
+
+template<typename Validator>
+inline auto ssybc::BlockMinerCPUBruteForce<Validator>::MineInfo(
+  BlockHash const & previous_hash,
+  BinaryData const & hashable_binary) const -> MinedResult
+{
+  MiningSession session{};
+  return MineInfo(previous_hash, hashable_binary, session);
+}
+
+
+template<typename Validator>
+inline auto ssybc::BlockMinerCPUBruteForce<Validator>::MineGenesisInfo(
+  BinaryData const & hashable_binary,
+  MiningSession & session) const -> MinedResult
 {
   logging::info << "Mining Genesis block variables..." << std::endl;
   auto const validator = Validator();
@@ -95,46 +149,34 @@ inline auto ssybc::BlockMinerCPUBruteForce<Validator>::MineGenesisInfo(
   BlockTimeInterval result_ts{ util::TrailingTimeStampBeforeNonceFromBinaryData(hashable_binary) };
   if (validator.IsValidGenesisBlockHash(hash_calculator.Hash(hashable_binary))) {
     logging::info << "Finished mining Genesis block variables." << std::endl;
-    return { result_ts, util::TrailingNonceFromBinaryData(hashable_binary) };
+    MinedResult const result{ result_ts, util::TrailingNonceFromBinaryData(hashable_binary) };
+    session.PublishResult(result);
+    return result;
   }
 
-  auto const hardware_threads_count = std::thread::hardware_concurrency();
-  auto thread_count = std::max<decltype(hardware_threads_count)>(1, hardware_threads_count);
-  auto const max_nonce = std::numeric_limits<BlockNonce>::max();
-  auto nonce_threads_gap = static_cast<BlockNonce>(max_nonce / thread_count);
-  if (nonce_threads_gap * thread_count != max_nonce) {
-    nonce_threads_gap = static_cast<BlockNonce>(max_nonce / (thread_count - 1));
-  }
-  logging::info << "Creating " + util::ToString(thread_count) + " threads for genesis block mining..." << std::endl;
-  std::vector<std::thread> worker_threads{};
-  for (decltype(thread_count) i{ 0 }; i < thread_count; ++i) {
-    worker_threads.push_back(std::thread(
-    MineGenesisInfoOnCPUThreadBruteForce_<Validator, HashCalculatorType>,
-    hashable_binary,
+  auto const thread_count = thread_pool_ptr_->Size();
+  logging::info << "Running " + util::ToString(thread_count) + " threads for genesis block mining..." << std::endl;
+  auto const dispenser_ptr = NonceDispenserOfSession_(
+    session,
     result_ts,
-    static_cast<BlockNonce>(i * nonce_threads_gap),
-    std::min(static_cast<BlockNonce>((i + 1) * nonce_threads_gap), max_nonce),
-    validator,
-    hash_calculator
-    ));
-  }
+    throttle_.IsEnabled() ? kThrottledNonceBatchSize : kDefaultNonceBatchSize);
+  auto const begin_time = stats_ptr_->BeginJob();
+  thread_pool_ptr_->Run([&](SizeT const worker_index) {
+    MiningThrottlePacer pacer{ throttle_, thread_count };
+    MineInfoOnCPUThreadBruteForce_(
+      session,
+      *dispenser_ptr,
+      *stats_ptr_,
+      pacer,
+      worker_index,
+      hashable_binary,
+      hash_calculator,
+      [&validator](BlockHash const &hash) { return validator.IsValidGenesisBlockHash(hash); });
+  });
+  logging::info << "Finished " + util::ToString(thread_count) + " threads for genesis block mining." << std::endl;
 
-  std::unique_lock<std::mutex> lock(block_mining_mtx_);
-  block_mined_cv_.wait(lock, [] { return is_block_mined_;  });
-  for (auto &worker : worker_threads) {
-    worker.join();
-  }
-  logging::info << "Joined " + util::ToString(thread_count) + " threads for genesis block mining." << std::endl;
-
-  auto const result = MinedResult{
-#ifdef SSYBC_HAS_ATOMIC_FOR_CUSTOM_TYPE
-    block_result_.load()
-#else
-    block_result_
-#endif
-  };
-  block_result_ = MinedResult();
-  is_block_mined_ = false;
+  stats_ptr_->EndJob(begin_time, session.HasResult());
+  auto const result = session.Result();
   logging::info << "Finished mining Genesis block variables." << std::endl;
   return result;
 }
@@ -143,7 +185,8 @@ inline auto ssybc::BlockMinerCPUBruteForce<Validator>::MineGenesisInfo(
 template<typename Validator>
 inline auto ssybc::BlockMinerCPUBruteForce<Validator>::MineInfo(
   BlockHash const & previous_hash,
-  BinaryData const & hashable_binary) const -> MinedResult
+  BinaryData const & hashable_binary,
+  MiningSession & session) const -> MinedResult
 {
   logging::info << "Mining block variables..." << std::endl;
   auto const validator = Validator();
@@ -152,47 +195,36 @@ inline auto ssybc::BlockMinerCPUBruteForce<Validator>::MineInfo(
   BlockTimeInterval result_ts{ util::TrailingTimeStampBeforeNonceFromBinaryData(hashable_binary) };
   if (validator.IsValidHashToAppend(previous_hash, hash_calculator.Hash(hashable_binary))) {
     logging::info << "Finished mining block variables." << std::endl;
-    return { result_ts, util::TrailingNonceFromBinaryData(hashable_binary) };
+    MinedResult const result{ result_ts, util::TrailingNonceFromBinaryData(hashable_binary) };
+    session.PublishResult(result);
+    return result;
   }
 
-  auto const hardware_threads_count = std::thread::hardware_concurrency();
-  auto thread_count = std::max<decltype(hardware_threads_count)>(1, hardware_threads_count);
-  auto const max_nonce = std::numeric_limits<BlockNonce>::max();
-  auto nonce_threads_gap = static_cast<BlockNonce>(max_nonce / thread_count);
-  if (nonce_threads_gap * thread_count != max_nonce) {
-    nonce_threads_gap = static_cast<BlockNonce>(max_nonce / (thread_count - 1));
-  }
-  std::vector<std::thread> worker_threads{};
-  logging::info << "Creating " + util::ToString(thread_count) + " threads for block mining..." << std::endl;
-  for (decltype(thread_count) i{ 0 }; i < thread_count; ++i) {
-    worker_threads.push_back(std::thread(
-      MineInfoOnCPUThreadBruteForce_<Validator, HashCalculatorType>,
-      previous_hash,
+  auto const thread_count = thread_pool_ptr_->Size();
+  auto const dispenser_ptr = NonceDispenserOfSession_(
+    session,
+    result_ts,
+    throttle_.IsEnabled() ? kThrottledNonceBatchSize : kDefaultNonceBatchSize);
+  auto const begin_time = stats_ptr_->BeginJob();
+  logging::info << "Running " + util::ToString(thread_count) + " threads for block mining..." << std::endl;
+  thread_pool_ptr_->Run([&](SizeT const worker_index) {
+    MiningThrottlePacer pacer{ throttle_, thread_count };
+    MineInfoOnCPUThreadBruteForce_(
+      session,
+      *dispenser_ptr,
+      *stats_ptr_,
+      pacer,
+      worker_index,
       hashable_binary,
-      result_ts,
-      static_cast<BlockNonce>(i * nonce_threads_gap),
-      std::min(static_cast<BlockNonce>((i + 1) * nonce_threads_gap), max_nonce),
-      validator,
-      hash_calculator
-    ));
-  }
-
-  std::unique_lock<std::mutex> lock(block_mining_mtx_);
-  block_mined_cv_.wait(lock, [] { return is_block_mined_;  });
-  for (auto &worker : worker_threads) {
-    worker.join();
-  }
-  logging::info << "Joined " + util::ToString(thread_count) + " threads for block mining." << std::endl;
-
-  auto const result = MinedResult{
-#ifdef SSYBC_HAS_ATOMIC_FOR_CUSTOM_TYPE
-    block_result_.load()
-#else
-    block_result_
-#endif
-  };
-  block_result_ = MinedResult();
-  is_block_mined_ = false;
+      hash_calculator,
+      [&validator, &previous_hash](BlockHash const &hash) {
+        return validator.IsValidHashToAppend(previous_hash, hash);
+      });
+  });
+  logging::info << "Finished " + util::ToString(thread_count) + " threads for block mining." << std::endl;
+
+  stats_ptr_->EndJob(begin_time, session.HasResult());
+  auto const result = session.Result();
   logging::info << "Finished mining block variables." << std::endl;
   return result;
 }
@@ -201,114 +233,118 @@ inline auto ssybc::BlockMinerCPUBruteForce<Validator>::MineInfo(
 // ----------------------------------------------------- Helper -------------------------------------------------------
 
 
-template<typename ValidatorT, typename HashCalculatorT>
-void ssybc::MineGenesisInfoOnCPUThreadBruteForce_(
+template<typename HashCalculatorT, typename HashPredicateT>
+void ssybc::MineInfoOnCPUThreadBruteForce_(
+  MiningSession & session,
+  NonceDispenser & dispenser,
+  MiningStats & stats,
+  MiningThrottlePacer & pacer,
+  SizeT const worker_index,
   BinaryData const & hashable_binary,
-  BlockTimeInterval const time_stamp,
-  BlockNonce const nonce_start,
-  BlockNonce const nonce_end,
-  ValidatorT const validator,
-  HashCalculatorT const hash_calculator)
+  HashCalculatorT const hash_calculator,
+  HashPredicateT const is_valid_hash)
 {
-  LogThreadMiningNonceInRange_(nonce_start, nonce_end);
-  BlockNonce result_nonce{ nonce_start };
-  BlockTimeInterval ts{ time_stamp };
-  auto binary_mutable_copy = BinaryData(hashable_binary.begin(), hashable_binary.end());
-  while (!is_block_mined_ && !validator.IsValidGenesisBlockHash(hash_calculator.Hash(binary_mutable_copy))) {
-    if (result_nonce >= nonce_end) {
-      ts = util::UTCTime();
-      util::UpdateBinaryDataWithTrailingTimeStampBeforeNonce(binary_mutable_copy, ts);
-      result_nonce = 0;
-    } else {
-      ++result_nonce;
+  LogThreadMiningNonceBatches_(dispenser.BatchSize());
+  // The only buffers are allocated here, once per job: a nonce attempt writes the nonce in place and hashes into
+  // "hash" on the stack.
+  auto const header_size = hashable_binary.size();
+  BinaryData header_buffer(header_size + kMiningCacheLineSize_ - 1);
+  Byte * const header{ AlignedToCacheLine_(header_buffer.data()) };
+  std::copy(hashable_binary.begin(), hashable_binary.end(), header);
+  auto const prefix_calculator_ptr = hash_calculator.CalculatorWithFixedPrefix(
+    MiningPrefixFromHashableBinary_(hashable_binary));
+  HashCalculatorInterface const &calculator = prefix_calculator_ptr
+    ? *prefix_calculator_ptr : static_cast<HashCalculatorInterface const &>(hash_calculator);
+  BlockHash hash{};
+  BlockTimeInterval const first_ts{ util::TrailingTimeStampBeforeNonceFromBinaryData(hashable_binary) };
+  BlockTimeInterval ts{ first_ts };
+
+  while (!session.StopIfPastDeadline()) {
+    auto const batch = dispenser.NextBatch();
+    if (batch.nonce_start == batch.nonce_end) {
+      break;
+    }
+    if (batch.time_stamp != ts) {
+      ts = batch.time_stamp;
+      util::UpdateBytesWithTrailingTimeStampBeforeNonce(header, header_size, ts);
+    }
+    if (batch.nonce_start == 0 && batch.time_stamp != first_ts) {
+      stats.AddTimeStampRollover();
+    }
+    BlockNonce nonce{ batch.nonce_start };
+    for (; nonce < batch.nonce_end && !session.IsStopped(); ++nonce) {
+      util::UpdateBytesWithTrailingNonce(header, header_size, nonce);
+      calculator.HashInto(header, header_size, hash);
+      if (!is_valid_hash(hash)) {
+        continue;
+      }
+      session.AddHashCount(nonce - batch.nonce_start + 1);
+      stats.AddAttempts(worker_index, nonce - batch.nonce_start + 1);
+      MinedResult const result{ ts, nonce };
+      if (session.PublishResult(result)) {
+        LogThreadMiningTerminatedWithValidResult_(result);
+      } else {
+        LogThreadMiningTerminatedWithoutValidResult_();
+      }
+      return;
     }
-    
-    util::UpdateBinaryDataWithTrailingNonce(binary_mutable_copy, result_nonce);
+    session.AddHashCount(nonce - batch.nonce_start);
+    stats.AddAttempts(worker_index, nonce - batch.nonce_start);
+    pacer.Pace(nonce - batch.nonce_start, session);
   }
 
-  if (is_block_mined_) {
-    LogThreadMiningNonceInRangeTerminatedWithoutValidResult_(nonce_start, nonce_end);
-  } else {
-    block_result_ = MinedResult{ ts, result_nonce };
-    is_block_mined_ = true;
-    LogThreadMiningNonceInRangeTerminatedWithValidResult_(nonce_start, nonce_end, result_nonce);
-    block_mined_cv_.notify_all();
-  }
+  LogThreadMiningTerminatedWithoutValidResult_();
 }
 
-template<typename ValidatorT, typename HashCalculatorT>
-void ssybc::MineInfoOnCPUThreadBruteForce_(
-  BinaryData const & previous_hash,
-  BinaryData const & hashable_binary,
+
+inline auto ssybc::NonceDispenserOfSession_(
+  MiningSession const &session,
   BlockTimeInterval const time_stamp,
-  BlockNonce const nonce_start,
-  BlockNonce const nonce_end,
-  ValidatorT const validator,
-  HashCalculatorT const hash_calculator)
+  BlockNonce const batch_size) -> std::unique_ptr<NonceDispenser>
 {
-  LogThreadMiningNonceInRange_(nonce_start, nonce_end);
-  BlockNonce result_nonce{ nonce_start };
-  BlockTimeInterval ts{ time_stamp };
-  auto binary_mutable_copy = BinaryData(hashable_binary.begin(), hashable_binary.end());
-  while (!is_block_mined_ && !validator.IsValidHashToAppend(
-      previous_hash,
-      hash_calculator.Hash(binary_mutable_copy))) {
-    if (result_nonce >= nonce_end) {
-      ts = util::UTCTime();
-      util::UpdateBinaryDataWithTrailingTimeStampBeforeNonce(binary_mutable_copy, ts);
-      result_nonce = 0;
-    }
-    else {
-      ++result_nonce;
-    }
-
-    util::UpdateBinaryDataWithTrailingNonce(binary_mutable_copy, result_nonce);
+  if (session.HasNonceRange()) {
+    return std::unique_ptr<NonceDispenser>(new NonceDispenser(session.NonceRange(), batch_size));
   }
+  return std::unique_ptr<NonceDispenser>(new NonceDispenser(time_stamp, batch_size));
+}
 
-  if (is_block_mined_) {
-    LogThreadMiningNonceInRangeTerminatedWithoutValidResult_(nonce_start, nonce_end);
-  } else {
-    block_result_ = MinedResult{ ts, result_nonce };
-    is_block_mined_ = true;
-    LogThreadMiningNonceInRangeTerminatedWithValidResult_(nonce_start, nonce_end, result_nonce);
-    block_mined_cv_.notify_all();
-  }
+
+// Everything before the trailing time stamp and nonce stays the same for a whole mining job.
+inline auto ssybc::MiningPrefixFromHashableBinary_(BinaryData const & hashable_binary) -> BinaryData
+{
+  auto end_iter = hashable_binary.end();
+  std::advance(end_iter, -1 * static_cast<int>(sizeof(BlockTimeInterval) + sizeof(BlockNonce)));
+  return BinaryData(hashable_binary.begin(), end_iter);
+}
+
+
+// "pointer" must have kMiningCacheLineSize_ - 1 spare bytes after the aligned region.
+inline auto ssybc::AlignedToCacheLine_(Byte * const pointer) -> Byte *
+{
+  auto const address = reinterpret_cast<std::uintptr_t>(pointer);
+  auto const offset = (kMiningCacheLineSize_ - address % kMiningCacheLineSize_) % kMiningCacheLineSize_;
+  return pointer + offset;
 }
 
 
-inline void ssybc::LogThreadMiningNonceInRange_(BlockNonce const start, BlockNonce const stop)
+inline void ssybc::LogThreadMiningNonceBatches_(BlockNonce const batch_size)
 {
-  logging::threading << "Thread mining nonce in range ["
-    + util::ToString(start)
-    + ", "
-    + util::ToString(stop)
-    + ")..." << std::endl;
+  logging::threading << "Thread mining nonce batches of size " + util::ToString(batch_size) + "..." << std::endl;
 }
 
 
-inline void ssybc::LogThreadMiningNonceInRangeTerminatedWithoutValidResult_(
-  BlockNonce const start,
-  BlockNonce const stop)
+inline void ssybc::LogThreadMiningTerminatedWithoutValidResult_()
 {
-  logging::threading << "Thread mining nonce in range ["
-    + util::ToString(start)
-    + ", "
-    + util::ToString(stop)
-    + ") terminated without valid result." << std::endl;
+  logging::threading << "Thread mining terminated without valid result." << std::endl;
 }
 
 
-inline void ssybc::LogThreadMiningNonceInRangeTerminatedWithValidResult_(
-  BlockNonce const start,
-  BlockNonce const stop,
-  BlockNonce const result)
+inline void ssybc::LogThreadMiningTerminatedWithValidResult_(MinedResult const result)
 {
-  logging::threading << "Thread mining nonce in range ["
-    + util::ToString(start)
-    + ", "
-    + util::ToString(stop)
-    + ") terminated with valid result: "
-    + util::ToString(result)
+  logging::threading << "Thread mining terminated with valid result: time stamp "
+    + util::ToString(result.time_stamp)
+    + ", nonce "
+    + util::ToString(result.nonce)
     + "." << std::endl;
 }
 
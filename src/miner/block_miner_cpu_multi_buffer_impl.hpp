@@ -0,0 +1,312 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+
+#ifndef SSYBC_SRC_MINER_BLOCK_MINER_CPU_MULTI_BUFFER_IMPL_HPP_
+#define SSYBC_SRC_MINER_BLOCK_MINER_CPU_MULTI_BUFFER_IMPL_HPP_
+
+#include "include/ssybc/miner/block_miner_cpu_multi_buffer.hpp"
+#include "include/ssybc/miner/block_miner_cpu_brute_force.hpp"
+#include "include/ssybc/miner/mining_session.hpp"
+#include "include/ssybc/miner/nonce_dispenser.hpp"
+#include "include/ssybc/utility/utility.hpp"
+#include "include/ssybc/logging/logging.hpp"
+
+#include <algorithm>
+#include <string>
+
+
+// ----------------------------------------------------- Helper -------------------------------------------------------
+
+namespace ssybc {
+
+  template<typename HashCalculatorT, typename HashPredicateT>
+  MinedResult MineInfoOnCPUMultiBuffer_(
+    MiningThreadPool & thread_pool,
+    MiningStats & stats,
+    MiningThrottle const & throttle,
+    MiningSession & session,
+    BinaryData const & hashable_binary,
+    HashCalculatorT const hash_calculator,
+    HashPredicateT const is_valid_hash,
+    std::string const & description);
+
+  template<typename HashCalculatorT, typename HashPredicateT>
+  void MineInfoOnCPUThreadMultiBuffer_(
+    MiningSession & session,
+    NonceDispenser & dispenser,
+    MiningStats & stats,
+    MiningThrottlePacer & pacer,
+    SizeT const worker_index,
+    BinaryData const & hashable_binary,
+    HashCalculatorT const hash_calculator,
+    HashPredicateT const is_valid_hash);
+
+}
+
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+
+template<typename Validator>
+inline ssybc::BlockMinerCPUMultiBuffer<Validator>::BlockMinerCPUMultiBuffer():
+  BlockMinerCPUMultiBuffer(std::make_shared<MiningThreadPool>())
+{ EMPTY_BLOCK }
+
+
+template<typename Validator>
+inline ssybc::BlockMinerCPUMultiBuffer<Validator>::BlockMinerCPUMultiBuffer(
+  std::shared_ptr<MiningThreadPool> thread_pool_ptr):
+  BlockMinerCPUMultiBuffer(thread_pool_ptr, MiningThrottle{})
+{ EMPTY_BLOCK }
+
+
+template<typename Validator>
+inline ssybc::BlockMinerCPUMultiBuffer<Validator>::BlockMinerCPUMultiBuffer(
+  std::shared_ptr<MiningThreadPool> thread_pool_ptr,
+  MiningThrottle const & throttle):
+  thread_pool_ptr_{ thread_pool_ptr },
+  stats_ptr_{ std::make_shared<MiningStats>(thread_pool_ptr->Size()) },
+  throttle_{ throttle }
+{ EMPTY_BLOCK }
+
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+
+template<typename Validator>
+inline auto ssybc::BlockMinerCPUMultiBuffer<Validator>::ThreadPoolPtr() const -> std::shared_ptr<MiningThreadPool>
+{
+  return thread_pool_ptr_;
+}
+
+
+template<typename Validator>
+inline auto ssybc::BlockMinerCPUMultiBuffer<Validator>::StatsPtr() const -> std::shared_ptr<MiningStats>
+{
+  return stats_ptr_;
+}
+
+
+template<typename Validator>
+inline auto ssybc::BlockMinerCPUMultiBuffer<Validator>::Throttle() const -> MiningThrottle
+{
+  return throttle_;
+}
+
+
+template<typename Validator>
+inline auto ssybc::BlockMinerCPUMultiBuffer<Validator>::MineGenesisInfo(
+  BinaryData const & hashable_binary) const -> MinedResult
+{
+  MiningSession session{};
+  return MineGenesisInfo(hashable_binary, session);
+}
+
+
+template<typename Validator>
+inline auto ssybc::BlockMinerCPUMultiBuffer<Validator>::MineInfo(
+  BlockHash const & previous_hash,
+  BinaryData const & hashable_binary) const -> MinedResult
+{
+  MiningSession session{};
+  return MineInfo(previous_hash, hashable_binary, session);
+}
+
+
+template<typename Validator>
+inline auto ssybc::BlockMinerCPUMultiBuffer<Validator>::MineGenesisInfo(
+  BinaryData const & hashable_binary,
+  MiningSession & session) const -> MinedResult
+{
+  logging::info << "Mining Genesis block variables..." << std::endl;
+  auto const validator = Validator();
+  auto const result = MineInfoOnCPUMultiBuffer_(
+    *thread_pool_ptr_,
+    *stats_ptr_,
+    throttle_,
+    session,
+    hashable_binary,
+    typename BlockMinerCPUMultiBuffer::HashCalculatorType(),
+    [validator](BlockHash const &hash) { return validator.IsValidGenesisBlockHash(hash); },
+    "genesis block");
+  logging::info << "Finished mining Genesis block variables." << std::endl;
+  return result;
+}
+
+
+template<typename Validator>
+inline auto ssybc::BlockMinerCPUMultiBuffer<Validator>::MineInfo(
+  BlockHash const & previous_hash,
+  BinaryData const & hashable_binary,
+  MiningSession & session) const -> MinedResult
+{
+  logging::info << "Mining block variables..." << std::endl;
+  auto const validator = Validator();
+  auto const result = MineInfoOnCPUMultiBuffer_(
+    *thread_pool_ptr_,
+    *stats_ptr_,
+    throttle_,
+    session,
+    hashable_binary,
+    typename BlockMinerCPUMultiBuffer::HashCalculatorType(),
+    [validator, previous_hash](BlockHash const &hash) { return validator.IsValidHashToAppend(previous_hash, hash); },
+    "block");
+  logging::info << "Finished mining block variables." << std::endl;
+  return result;
+}
+
+
+// ----------------------------------------------------- Helper -------------------------------------------------------
+
+
+template<typename HashCalculatorT, typename HashPredicateT>
+inline auto ssybc::MineInfoOnCPUMultiBuffer_(
+  MiningThreadPool & thread_pool,
+  MiningStats & stats,
+  MiningThrottle const & throttle,
+  MiningSession & session,
+  BinaryData const & hashable_binary,
+  HashCalculatorT const hash_calculator,
+  HashPredicateT const is_valid_hash,
+  std::string const & description) -> MinedResult
+{
+  BlockTimeInterval const result_ts{ util::TrailingTimeStampBeforeNonceFromBinaryData(hashable_binary) };
+  if (is_valid_hash(hash_calculator.Hash(hashable_binary))) {
+    MinedResult const result{ result_ts, util::TrailingNonceFromBinaryData(hashable_binary) };
+    session.PublishResult(result);
+    return result;
+  }
+
+  auto const thread_count = thread_pool.Size();
+  auto const lane_count = static_cast<BlockNonce>(std::max<SizeT>(1, hash_calculator.BatchLaneCount()));
+  logging::info
+    << "Running " + util::ToString(thread_count) + " threads with "
+    + util::ToString(lane_count) + " hash lanes each for " + description + " mining..."
+    << std::endl;
+  // Whole batches of lanes per nonce batch, so no hash call straddles two time stamps.
+  auto const nonce_batch_size = throttle.IsEnabled() ? kThrottledNonceBatchSize : kDefaultNonceBatchSize;
+  auto const dispenser_ptr = NonceDispenserOfSession_(session, result_ts, nonce_batch_size / lane_count * lane_count);
+  auto const begin_time = stats.BeginJob();
+  thread_pool.Run([&](SizeT const worker_index) {
+    MiningThrottlePacer pacer{ throttle, thread_count };
+    MineInfoOnCPUThreadMultiBuffer_(
+      session,
+      *dispenser_ptr,
+      stats,
+      pacer,
+      worker_index,
+      hashable_binary,
+      hash_calculator,
+      is_valid_hash);
+  });
+  stats.EndJob(begin_time, session.HasResult());
+  logging::info << "Finished " + util::ToString(thread_count) + " threads for " + description + " mining." << std::endl;
+
+  return session.Result();
+}
+
+
+template<typename HashCalculatorT, typename HashPredicateT>
+void ssybc::MineInfoOnCPUThreadMultiBuffer_(
+  MiningSession & session,
+  NonceDispenser & dispenser,
+  MiningStats & stats,
+  MiningThrottlePacer & pacer,
+  SizeT const worker_index,
+  BinaryData const & hashable_binary,
+  HashCalculatorT const hash_calculator,
+  HashPredicateT const is_valid_hash)
+{
+  LogThreadMiningNonceBatches_(dispenser.BatchSize());
+  auto const lane_count = static_cast<BlockNonce>(std::max<SizeT>(1, hash_calculator.BatchLaneCount()));
+  // One buffer for all lanes, allocated once per job, every lane on its own cache lines.
+  auto const header_size = hashable_binary.size();
+  auto const lane_stride = (header_size + kMiningCacheLineSize_ - 1) / kMiningCacheLineSize_ * kMiningCacheLineSize_;
+  BinaryData lane_buffer(static_cast<std::size_t>(lane_count) * lane_stride + kMiningCacheLineSize_ - 1);
+  Byte * const first_lane{ AlignedToCacheLine_(lane_buffer.data()) };
+  std::vector<Byte const *> lane_pointers{};
+  for (BlockNonce lane{ 0 }; lane < lane_count; ++lane) {
+    Byte * const lane_bytes{ first_lane + static_cast<std::size_t>(lane) * lane_stride };
+    std::copy(hashable_binary.begin(), hashable_binary.end(), lane_bytes);
+    lane_pointers.push_back(lane_bytes);
+  }
+  auto const prefix_calculator_ptr = hash_calculator.CalculatorWithFixedPrefix(
+    MiningPrefixFromHashableBinary_(hashable_binary));
+  HashCalculatorInterface const &calculator = prefix_calculator_ptr
+    ? *prefix_calculator_ptr : static_cast<HashCalculatorInterface const &>(hash_calculator);
+  std::vector<BlockHash> lane_hashes(static_cast<std::size_t>(lane_count));
+  BlockTimeInterval const first_ts{ util::TrailingTimeStampBeforeNonceFromBinaryData(hashable_binary) };
+  BlockTimeInterval ts{ first_ts };
+
+  while (!session.StopIfPastDeadline()) {
+    auto const batch = dispenser.NextBatch();
+    if (batch.nonce_start == batch.nonce_end) {
+      break;
+    }
+    if (batch.time_stamp != ts) {
+      ts = batch.time_stamp;
+      for (BlockNonce lane{ 0 }; lane < lane_count; ++lane) {
+        util::UpdateBytesWithTrailingTimeStampBeforeNonce(
+          first_lane + static_cast<std::size_t>(lane) * lane_stride,
+          header_size,
+          ts);
+      }
+    }
+    if (batch.nonce_start == 0 && batch.time_stamp != first_ts) {
+      stats.AddTimeStampRollover();
+    }
+    BlockNonce batch_nonce{ batch.nonce_start };
+    while (batch_nonce < batch.nonce_end && !session.IsStopped()) {
+      auto const hash_count = std::min(lane_count, batch.nonce_end - batch_nonce);
+      for (BlockNonce lane{ 0 }; lane < hash_count; ++lane) {
+        util::UpdateBytesWithTrailingNonce(
+          first_lane + static_cast<std::size_t>(lane) * lane_stride,
+          header_size,
+          batch_nonce + lane);
+      }
+
+      calculator.HashBatchInto(lane_pointers.data(), hash_count, header_size, lane_hashes.data());
+      batch_nonce += hash_count;
+      for (BlockNonce lane{ 0 }; lane < hash_count; ++lane) {
+        if (!is_valid_hash(lane_hashes[static_cast<std::size_t>(lane)])) {
+          continue;
+        }
+        session.AddHashCount(batch_nonce - batch.nonce_start);
+        stats.AddAttempts(worker_index, batch_nonce - batch.nonce_start);
+        MinedResult const result{ ts, batch_nonce - hash_count + lane };
+        if (session.PublishResult(result)) {
+          LogThreadMiningTerminatedWithValidResult_(result);
+        } else {
+          LogThreadMiningTerminatedWithoutValidResult_();
+        }
+        return;
+      }
+    }
+    session.AddHashCount(batch_nonce - batch.nonce_start);
+    stats.AddAttempts(worker_index, batch_nonce - batch.nonce_start);
+    pacer.Pace(batch_nonce - batch.nonce_start, session);
+  }
+
+  LogThreadMiningTerminatedWithoutValidResult_();
+}
+
+
+#endif  // SSYBC_SRC_MINER_BLOCK_MINER_CPU_MULTI_BUFFER_IMPL_HPP_
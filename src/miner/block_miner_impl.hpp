@@ -26,14 +26,58 @@
 #include "include/ssybc/logging/logging.hpp"
 
 #include <exception>
+#include <stdexcept>
 #include <typeinfo>
 
 
 // --------------------------------------------------- Public Method --------------------------------------------------
 
 
+template<typename Validator>
+inline auto ssybc::BlockMiner<Validator>::MineGenesisInfo(
+  BinaryData const & hashable_binary,
+  MiningSession & session) const -> MinedResult
+{
+  auto const result = MineGenesisInfo(hashable_binary);
+  session.PublishResult(result);
+  return result;
+}
+
+
+template<typename Validator>
+inline auto ssybc::BlockMiner<Validator>::MineInfo(
+  BlockHash const & previous_hash,
+  BinaryData const & hashable_binary,
+  MiningSession & session) const -> MinedResult
+{
+  auto const result = MineInfo(previous_hash, hashable_binary);
+  session.PublishResult(result);
+  return result;
+}
+
+
 template<typename Validator>
 inline auto ssybc::BlockMiner<Validator>::MineGenesis(BlockType const & block) const -> BlockType
+{
+  MiningSession session{};
+  return MineGenesis(block, session);
+}
+
+
+template<typename Validator>
+inline auto ssybc::BlockMiner<Validator>::Mine(
+  BlockType const & previous_block,
+  BlockType const & block) const -> BlockType
+{
+  MiningSession session{};
+  return Mine(previous_block, block, session);
+}
+
+
+template<typename Validator>
+inline auto ssybc::BlockMiner<Validator>::MineGenesis(
+  BlockType const & block,
+  MiningSession & session) const -> BlockType
 {
   logging::debug << "Mining Genesis block..." << std::endl;
   if (block.Header().Index() != 0) {
@@ -50,7 +94,10 @@ inline auto ssybc::BlockMiner<Validator>::MineGenesis(BlockType const & block) c
     );
   }
   auto const hashable_binary = block.Header().Binary();
-  auto const mined_result = MineGenesisInfo(hashable_binary);
+  auto const mined_result = MineGenesisInfo(hashable_binary, session);
+  if (!session.HasResult()) {
+    throw std::runtime_error("Cannot mine Genesis Block, mining was stopped before a valid nonce was found.");
+  }
   auto const old_header = block.Header();
   typename BlockType::BlockHeaderType result_header{
     old_header.Version(),
@@ -78,7 +125,8 @@ inline auto ssybc::BlockMiner<Validator>::MineGenesis(BlockType const & block) c
 template<typename Validator>
 inline auto ssybc::BlockMiner<Validator>::Mine(
   BlockType const & previous_block,
-  BlockType const & block) const -> BlockType
+  BlockType const & block,
+  MiningSession & session) const -> BlockType
 {
   logging::debug << "Mining block # " << util::ToString(block.Header().Index()) << "..." << std::endl;
   if (block.Header().PreviousHash() != previous_block.Header().Hash()) {
@@ -88,7 +136,13 @@ inline auto ssybc::BlockMiner<Validator>::Mine(
     );
   }
   auto const header_hash = block.Header().Binary();
-  auto const mined_result = MineInfo(previous_block.Header().Hash(), header_hash);
+  auto const mined_result = MineInfo(previous_block.Header().Hash(), header_hash, session);
+  if (!session.HasResult()) {
+    throw std::runtime_error(
+      "Cannot mine Block " + std::to_string(block.Header().Index()) + ", mining was stopped before a valid nonce "
+      "was found."
+    );
+  }
   auto const old_header = block.Header();
   typename BlockType::BlockHeaderType result_header{
     old_header.Version(),
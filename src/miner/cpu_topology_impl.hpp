@@ -0,0 +1,221 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_SRC_MINER_CPU_TOPOLOGY_IMPL_HPP_
+#define SSYBC_SRC_MINER_CPU_TOPOLOGY_IMPL_HPP_
+
+#include "include/ssybc/miner/cpu_topology.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <thread>
+#include <utility>
+
+#ifdef SSYBC_HAS_PTHREAD_SETAFFINITY_NP
+#include <sched.h>
+#endif
+
+
+// ----------------------------------------------------- Helper -------------------------------------------------------
+
+namespace ssybc {
+
+  bool ReadFirstLineOfFile_(std::string const &file_path, std::string &line);
+  std::vector<SizeT> AllowedCPUIdsOfProcess_();
+
+}
+
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+
+inline ssybc::CPUTopology::CPUTopology(std::vector<LogicalCPU> const & cpus):
+  cpus_{ cpus }
+{
+  std::sort(cpus_.begin(), cpus_.end(), [](LogicalCPU const &lhs, LogicalCPU const &rhs) { return lhs.id < rhs.id; });
+}
+
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+
+inline auto ssybc::CPUTopology::LogicalCPUs() const -> std::vector<LogicalCPU> const &
+{
+  return cpus_;
+}
+
+
+inline auto ssybc::CPUTopology::CPUIds() const -> std::vector<SizeT>
+{
+  std::vector<SizeT> result{};
+  for (auto const &cpu : cpus_) {
+    result.push_back(cpu.id);
+  }
+  return result;
+}
+
+
+inline auto ssybc::CPUTopology::PhysicalCoreCount() const -> SizeT
+{
+  return WithoutSMTSiblings().LogicalCPUs().size();
+}
+
+
+inline auto ssybc::CPUTopology::WithoutSMTSiblings() const -> CPUTopology
+{
+  std::set<std::pair<SizeT, SizeT>> seen_cores{};
+  std::vector<LogicalCPU> result{};
+  for (auto const &cpu : cpus_) {
+    if (seen_cores.insert({ cpu.package_id, cpu.core_id }).second) {
+      result.push_back(cpu);
+    }
+  }
+  return CPUTopology{ result };
+}
+
+
+inline auto ssybc::CPUTopology::WithoutFirstCores(SizeT const core_count) const -> CPUTopology
+{
+  std::set<std::pair<SizeT, SizeT>> dropped_cores{};
+  for (auto const &cpu : cpus_) {
+    if (dropped_cores.size() >= core_count) {
+      break;
+    }
+    dropped_cores.insert({ cpu.package_id, cpu.core_id });
+  }
+  std::vector<LogicalCPU> result{};
+  for (auto const &cpu : cpus_) {
+    if (dropped_cores.count({ cpu.package_id, cpu.core_id }) == 0) {
+      result.push_back(cpu);
+    }
+  }
+  return CPUTopology{ result };
+}
+
+
+inline auto ssybc::CPUTopology::RestrictedTo(std::vector<SizeT> const & cpu_ids) const -> CPUTopology
+{
+  std::vector<LogicalCPU> result{};
+  for (auto const &cpu : cpus_) {
+    if (std::find(cpu_ids.begin(), cpu_ids.end(), cpu.id) != cpu_ids.end()) {
+      result.push_back(cpu);
+    }
+  }
+  return CPUTopology{ result };
+}
+
+
+inline auto ssybc::CPUTopology::Current() -> CPUTopology
+{
+  auto topology = FromSysfs("/sys/devices/system/cpu");
+  auto const allowed_cpu_ids = AllowedCPUIdsOfProcess_();
+  if (!allowed_cpu_ids.empty()) {
+    topology = topology.RestrictedTo(allowed_cpu_ids);
+  }
+  if (!topology.LogicalCPUs().empty()) {
+    return topology;
+  }
+
+  std::vector<LogicalCPU> cpus{};
+  auto const cpu_count = std::max<SizeT>(1, std::thread::hardware_concurrency());
+  for (SizeT i{ 0 }; i < cpu_count; ++i) {
+    cpus.push_back({ i, i, 0 });
+  }
+  return CPUTopology{ cpus };
+}
+
+
+inline auto ssybc::CPUTopology::FromSysfs(std::string const & cpu_directory) -> CPUTopology
+{
+  std::string online_list{};
+  if (!ReadFirstLineOfFile_(cpu_directory + "/online", online_list)) {
+    return CPUTopology{ {} };
+  }
+
+  std::vector<LogicalCPU> cpus{};
+  for (auto const cpu_id : CPUIdsFromList(online_list)) {
+    auto const topology_directory = cpu_directory + "/cpu" + std::to_string(cpu_id) + "/topology";
+    LogicalCPU cpu{ cpu_id, cpu_id, 0 };
+    std::string line{};
+    if (ReadFirstLineOfFile_(topology_directory + "/core_id", line)) {
+      cpu.core_id = static_cast<SizeT>(std::stoull(line));
+    }
+    if (ReadFirstLineOfFile_(topology_directory + "/physical_package_id", line)) {
+      cpu.package_id = static_cast<SizeT>(std::stoull(line));
+    }
+    cpus.push_back(cpu);
+  }
+  return CPUTopology{ cpus };
+}
+
+
+inline auto ssybc::CPUTopology::CPUIdsFromList(std::string const & cpu_list) -> std::vector<SizeT>
+{
+  std::vector<SizeT> result{};
+  std::stringstream list_stream{ cpu_list };
+  std::string range{};
+  while (std::getline(list_stream, range, ',')) {
+    auto const first_digit = range.find_first_of("0123456789");
+    if (first_digit == std::string::npos) {
+      continue;
+    }
+    auto const dash = range.find('-', first_digit);
+    auto const first = static_cast<SizeT>(std::stoull(range.substr(first_digit)));
+    auto const last = dash == std::string::npos ? first : static_cast<SizeT>(std::stoull(range.substr(dash + 1)));
+    for (auto cpu_id = first; cpu_id <= last; ++cpu_id) {
+      result.push_back(cpu_id);
+    }
+  }
+  return result;
+}
+
+
+// ----------------------------------------------------- Helper -------------------------------------------------------
+
+
+inline bool ssybc::ReadFirstLineOfFile_(std::string const & file_path, std::string & line)
+{
+  std::ifstream file{ file_path };
+  return static_cast<bool>(std::getline(file, line)) && !line.empty();
+}
+
+
+// Empty if the platform cannot tell.
+inline auto ssybc::AllowedCPUIdsOfProcess_() -> std::vector<SizeT>
+{
+  std::vector<SizeT> result{};
+#ifdef SSYBC_HAS_PTHREAD_SETAFFINITY_NP
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  if (sched_getaffinity(0, sizeof(cpus), &cpus) == 0) {
+    for (int i{ 0 }; i < CPU_SETSIZE; ++i) {
+      if (CPU_ISSET(i, &cpus)) {
+        result.push_back(static_cast<SizeT>(i));
+      }
+    }
+  }
+#endif
+  return result;
+}
+
+
+#endif  // SSYBC_SRC_MINER_CPU_TOPOLOGY_IMPL_HPP_
@@ -0,0 +1,235 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_SRC_MINER_MINER_REGISTRY_IMPL_HPP_
+#define SSYBC_SRC_MINER_MINER_REGISTRY_IMPL_HPP_
+
+#include "include/ssybc/miner/miner_registry.hpp"
+#include "include/ssybc/miner/block_miner_cpu_brute_force.hpp"
+#include "include/ssybc/miner/block_miner_cpu_multi_buffer.hpp"
+#include "include/ssybc/miner/mining_thread_pool.hpp"
+#include "include/ssybc/miner/mining_session.hpp"
+#include "include/ssybc/utility/utility.hpp"
+#include "include/ssybc/logging/logging.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+
+template<typename Validator>
+inline ssybc::MinerRegistry<Validator>::MinerRegistry()
+{
+  auto const brute_force_factory = [](std::shared_ptr<MiningThreadPool> const &thread_pool_ptr) {
+    return std::make_shared<BlockMinerCPUBruteForce<Validator>>(thread_pool_ptr);
+  };
+  auto const multi_buffer_factory = [](std::shared_ptr<MiningThreadPool> const &thread_pool_ptr) {
+    return std::make_shared<BlockMinerCPUMultiBuffer<Validator>>(thread_pool_ptr);
+  };
+  Register("cpu-brute-force", 0, brute_force_factory);
+  Register("cpu-brute-force-single-thread", 1, brute_force_factory);
+  Register("cpu-multi-buffer", 0, multi_buffer_factory);
+  Register("cpu-multi-buffer-single-thread", 1, multi_buffer_factory);
+}
+
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+
+template<typename Validator>
+inline void ssybc::MinerRegistry<Validator>::Register(std::string const &name, MinerFactory const &factory)
+{
+  Register_({ name, factory, PooledMinerFactory{}, 0 });
+}
+
+
+template<typename Validator>
+inline void ssybc::MinerRegistry<Validator>::Register(
+  std::string const &name,
+  SizeT const thread_count,
+  PooledMinerFactory const &factory)
+{
+  Register_({ name, MinerFactory{}, factory, thread_count });
+}
+
+
+template<typename Validator>
+inline bool ssybc::MinerRegistry<Validator>::Contains(std::string const &name) const
+{
+  auto const entries = Entries_();
+  return std::any_of(entries.begin(), entries.end(), [&name](Entry_ const &entry) { return entry.name == name; });
+}
+
+
+template<typename Validator>
+inline auto ssybc::MinerRegistry<Validator>::Names() const -> std::vector<std::string>
+{
+  std::vector<std::string> result{};
+  for (auto const &entry : Entries_()) {
+    result.push_back(entry.name);
+  }
+  return result;
+}
+
+
+template<typename Validator>
+inline auto ssybc::MinerRegistry<Validator>::Create(std::string const &name) const -> std::shared_ptr<MinerType>
+{
+  auto const miner_name = name == kAutoMinerName ? FastestMinerName() : name;
+  for (auto const &entry : Entries_()) {
+    if (entry.name == miner_name) {
+      return entry.pooled_factory ? entry.pooled_factory(NewThreadPool_(entry.thread_count)) : entry.factory();
+    }
+  }
+  throw std::invalid_argument("No miner is registered as \"" + name + "\".");
+}
+
+
+template<typename Validator>
+inline auto ssybc::MinerRegistry<Validator>::Benchmark(
+  std::chrono::milliseconds const duration_per_miner) const -> std::vector<MinerBenchmark>
+{
+  std::lock_guard<std::mutex> benchmark_lock(benchmark_mutex_);
+  std::vector<MinerBenchmark> result{};
+  for (auto const &entry : Entries_()) {
+    double hashes_per_second{ 0.0 };
+    try {
+      if (entry.pooled_factory) {
+        auto const thread_pool_ptr = NewThreadPool_(entry.thread_count);
+        hashes_per_second = HashesPerSecondOfMiner_(*entry.pooled_factory(thread_pool_ptr), duration_per_miner);
+        thread_pool_ptr->Shutdown();
+      } else {
+        hashes_per_second = HashesPerSecondOfMiner_(*entry.factory(), duration_per_miner);
+      }
+    } catch (std::exception const &error) {
+      logging::warning << "Cannot benchmark miner \"" + entry.name + "\": " + std::string(error.what()) << std::endl;
+    }
+    logging::info << "Miner \"" + entry.name + "\" mines "
+      + util::ToString(static_cast<std::uint64_t>(hashes_per_second)) + " hashes per second." << std::endl;
+    result.push_back({ entry.name, hashes_per_second });
+  }
+  return result;
+}
+
+
+template<typename Validator>
+inline auto ssybc::MinerRegistry<Validator>::Benchmark() const -> std::vector<MinerBenchmark>
+{
+  return Benchmark(kDefaultMinerBenchmarkDuration);
+}
+
+
+// Ties go to the miner registered first, so built-in miners win over slower or uncounted ones.
+template<typename Validator>
+inline auto ssybc::MinerRegistry<Validator>::FastestMinerName() const -> std::string
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!fastest_miner_name_.empty()) {
+      return fastest_miner_name_;
+    }
+  }
+  auto const benchmarks = Benchmark();
+  if (benchmarks.empty()) {
+    throw std::invalid_argument("No miner is registered.");
+  }
+  auto fastest_iter = benchmarks.begin();
+  for (auto iter = benchmarks.begin(); iter != benchmarks.end(); ++iter) {
+    if (iter->hashes_per_second > fastest_iter->hashes_per_second) {
+      fastest_iter = iter;
+    }
+  }
+  logging::info << "Picked miner \"" + fastest_iter->miner_name + "\"." << std::endl;
+  std::lock_guard<std::mutex> lock(mutex_);
+  fastest_miner_name_ = fastest_iter->miner_name;
+  return fastest_miner_name_;
+}
+
+
+template<typename Validator>
+inline auto ssybc::MinerRegistry<Validator>::Default() -> MinerRegistry &
+{
+  static MinerRegistry registry{};
+  return registry;
+}
+
+
+// -------------------------------------------------- Private Method --------------------------------------------------
+
+
+template<typename Validator>
+inline void ssybc::MinerRegistry<Validator>::Register_(Entry_ const &entry)
+{
+  if (entry.name.empty() || entry.name == kAutoMinerName) {
+    throw std::invalid_argument("Cannot register a miner as \"" + entry.name + "\".");
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto const &registered_entry : entries_) {
+    if (registered_entry.name == entry.name) {
+      throw std::invalid_argument("A miner is already registered as \"" + entry.name + "\".");
+    }
+  }
+  entries_.push_back(entry);
+  fastest_miner_name_.clear();
+}
+
+
+// Factories run without the lock, so they may use the registry themselves.
+template<typename Validator>
+inline auto ssybc::MinerRegistry<Validator>::Entries_() const -> std::vector<Entry_>
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_;
+}
+
+
+template<typename Validator>
+inline auto ssybc::MinerRegistry<Validator>::NewThreadPool_(
+  SizeT const thread_count) -> std::shared_ptr<MiningThreadPool>
+{
+  return thread_count == 0 ? std::make_shared<MiningThreadPool>() : std::make_shared<MiningThreadPool>(thread_count);
+}
+
+
+// Mines genesis headers with increasing indices until "duration" is over, every header is a different puzzle.
+template<typename Validator>
+inline double ssybc::MinerRegistry<Validator>::HashesPerSecondOfMiner_(
+  MinerType const &miner,
+  std::chrono::milliseconds const duration)
+{
+  using BlockHeaderType = typename Validator::BlockType::BlockHeaderType;
+  auto const begin_time = std::chrono::steady_clock::now();
+  auto const deadline = begin_time + duration;
+  std::uint64_t hash_count{ 0 };
+  for (BlockIndex index{ 0 }; std::chrono::steady_clock::now() < deadline; ++index) {
+    BlockHeaderType const header{ 0, index, BlockHash(), BlockHash(), util::UTCTime(), kDefaultNonce };
+    MiningSession session{ deadline };
+    miner.MineGenesisInfo(header.Binary(), session);
+    hash_count += session.HashCount();
+  }
+  std::chrono::duration<double> const elapsed_time{ std::chrono::steady_clock::now() - begin_time };
+  return static_cast<double>(hash_count) / elapsed_time.count();
+}
+
+
+#endif  // SSYBC_SRC_MINER_MINER_REGISTRY_IMPL_HPP_
@@ -0,0 +1,107 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_SRC_MINER_MINING_JOB_IMPL_HPP_
+#define SSYBC_SRC_MINER_MINING_JOB_IMPL_HPP_
+
+#include "include/ssybc/miner/mining_job.hpp"
+
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+
+template<typename BlockT>
+inline ssybc::MiningJob<BlockT>::MiningJob(
+  std::shared_ptr<MiningSession> const & session_ptr,
+  std::future<BlockT> && future):
+  session_ptr_{ session_ptr },
+  future_{ std::move(future) }
+{ EMPTY_BLOCK }
+
+
+template<typename BlockT>
+inline ssybc::MiningJob<BlockT>::~MiningJob()
+{
+  if (session_ptr_) {
+    session_ptr_->Stop();
+  }
+}
+
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+
+template<typename BlockT>
+inline void ssybc::MiningJob<BlockT>::Cancel()
+{
+  if (session_ptr_) {
+    session_ptr_->Stop();
+  }
+}
+
+
+template<typename BlockT>
+inline bool ssybc::MiningJob<BlockT>::IsStopped() const
+{
+  return !session_ptr_ || session_ptr_->IsStopped();
+}
+
+
+template<typename BlockT>
+inline bool ssybc::MiningJob<BlockT>::IsReady() const
+{
+  return !future_.valid() || future_.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+
+template<typename BlockT>
+inline auto ssybc::MiningJob<BlockT>::HashCount() const -> std::uint64_t
+{
+  return session_ptr_ ? session_ptr_->HashCount() : 0;
+}
+
+
+template<typename BlockT>
+inline void ssybc::MiningJob<BlockT>::Wait() const
+{
+  if (future_.valid()) {
+    future_.wait();
+  }
+}
+
+
+template<typename BlockT>
+inline bool ssybc::MiningJob<BlockT>::WaitUntil(std::chrono::steady_clock::time_point const time_point) const
+{
+  return !future_.valid() || future_.wait_until(time_point) == std::future_status::ready;
+}
+
+
+template<typename BlockT>
+inline BlockT ssybc::MiningJob<BlockT>::Get()
+{
+  if (!future_.valid()) {
+    throw std::runtime_error("MiningJob has no block to get, it was moved from or Get() was already called.");
+  }
+  return future_.get();
+}
+
+
+#endif  // SSYBC_SRC_MINER_MINING_JOB_IMPL_HPP_
@@ -0,0 +1,155 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_SRC_MINER_MINING_SESSION_IMPL_HPP_
+#define SSYBC_SRC_MINER_MINING_SESSION_IMPL_HPP_
+
+#include "include/ssybc/miner/mining_session.hpp"
+
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+
+inline ssybc::MiningSession::MiningSession(std::chrono::steady_clock::time_point const deadline):
+  deadline_{ deadline }
+{ EMPTY_BLOCK }
+
+
+inline ssybc::MiningSession::MiningSession(NonceBatch const &nonce_range):
+  MiningSession(nonce_range, std::chrono::steady_clock::time_point::max())
+{ EMPTY_BLOCK }
+
+
+inline ssybc::MiningSession::MiningSession(
+  NonceBatch const &nonce_range,
+  std::chrono::steady_clock::time_point const deadline):
+  deadline_{ deadline },
+  has_nonce_range_{ true },
+  nonce_range_(nonce_range)
+{ EMPTY_BLOCK }
+
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+
+inline bool ssybc::MiningSession::IsStopped() const
+{
+  return is_stopped_.load(std::memory_order_relaxed);
+}
+
+
+inline bool ssybc::MiningSession::StopIfPastDeadline()
+{
+  if (IsStopped()) {
+    return true;
+  }
+  if (deadline_ != std::chrono::steady_clock::time_point::max() && std::chrono::steady_clock::now() >= deadline_) {
+    Stop();
+    return true;
+  }
+  return false;
+}
+
+
+inline auto ssybc::MiningSession::Deadline() const -> std::chrono::steady_clock::time_point
+{
+  return deadline_;
+}
+
+
+inline bool ssybc::MiningSession::HasNonceRange() const
+{
+  return has_nonce_range_;
+}
+
+
+inline auto ssybc::MiningSession::NonceRange() const -> NonceBatch
+{
+  return nonce_range_;
+}
+
+
+inline void ssybc::MiningSession::AddHashCount(std::uint64_t const count)
+{
+  hash_count_.fetch_add(count, std::memory_order_relaxed);
+}
+
+
+inline auto ssybc::MiningSession::HashCount() const -> std::uint64_t
+{
+  return hash_count_.load(std::memory_order_relaxed);
+}
+
+
+inline bool ssybc::MiningSession::PublishResult(MinedResult const result)
+{
+  bool expected{ false };
+  if (!is_result_claimed_.compare_exchange_strong(expected, true)) {
+    return false;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    result_ = result;
+    has_result_ = true;
+  }
+  Stop();
+  return true;
+}
+
+
+inline void ssybc::MiningSession::Stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    is_stopped_.store(true);
+  }
+  stopped_cv_.notify_all();
+}
+
+
+inline void ssybc::MiningSession::WaitUntilStopped()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (deadline_ == std::chrono::steady_clock::time_point::max()) {
+    stopped_cv_.wait(lock, [this] { return is_stopped_.load(); });
+    return;
+  }
+  if (!stopped_cv_.wait_until(lock, deadline_, [this] { return is_stopped_.load(); })) {
+    lock.unlock();
+    Stop();
+  }
+}
+
+
+inline bool ssybc::MiningSession::HasResult() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return has_result_;
+}
+
+
+inline auto ssybc::MiningSession::Result() const -> MinedResult
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return result_;
+}
+
+
+#endif  // SSYBC_SRC_MINER_MINING_SESSION_IMPL_HPP_
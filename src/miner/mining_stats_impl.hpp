@@ -0,0 +1,115 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_SRC_MINER_MINING_STATS_IMPL_HPP_
+#define SSYBC_SRC_MINER_MINING_STATS_IMPL_HPP_
+
+#include "include/ssybc/miner/mining_stats.hpp"
+
+#include <algorithm>
+
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+
+inline ssybc::MiningStats::MiningStats(SizeT const worker_count):
+  worker_count_{ std::max<SizeT>(1, worker_count) },
+  worker_attempt_counts_{ new PaddedCounter_[static_cast<std::size_t>(std::max<SizeT>(1, worker_count))] }
+{ EMPTY_BLOCK }
+
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+
+inline auto ssybc::MiningStats::WorkerCount() const -> SizeT
+{
+  return worker_count_;
+}
+
+
+inline auto ssybc::MiningStats::Snapshot() const -> MiningStatsSnapshot
+{
+  MiningStatsSnapshot result{};
+  for (SizeT i{ 0 }; i < worker_count_; ++i) {
+    auto const count = worker_attempt_counts_[static_cast<std::size_t>(i)].value.load(std::memory_order_relaxed);
+    result.worker_attempt_counts.push_back(count);
+    result.attempt_count += count;
+  }
+
+  auto mining_duration_ns = finished_job_duration_ns_.load(std::memory_order_relaxed);
+  if (running_job_count_.load(std::memory_order_relaxed) > 0) {
+    auto const now_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+    mining_duration_ns += std::max<std::int64_t>(0, now_ns - running_job_begin_ns_.load(std::memory_order_relaxed));
+  }
+  if (mining_duration_ns > 0) {
+    result.hashes_per_second
+      = static_cast<double>(result.attempt_count) * 1e9 / static_cast<double>(mining_duration_ns);
+  }
+
+  result.solved_block_count = solved_block_count_.load(std::memory_order_relaxed);
+  result.last_time_to_solution = std::chrono::nanoseconds(last_time_to_solution_ns_.load(std::memory_order_relaxed));
+  result.total_time_to_solution = std::chrono::nanoseconds(
+    total_time_to_solution_ns_.load(std::memory_order_relaxed));
+  result.time_stamp_rollover_count = time_stamp_rollover_count_.load(std::memory_order_relaxed);
+  return result;
+}
+
+
+inline auto ssybc::MiningStats::BeginJob() -> std::chrono::steady_clock::time_point
+{
+  auto const begin_time = std::chrono::steady_clock::now();
+  running_job_begin_ns_.store(
+    std::chrono::duration_cast<std::chrono::nanoseconds>(begin_time.time_since_epoch()).count(),
+    std::memory_order_relaxed);
+  running_job_count_.fetch_add(1, std::memory_order_relaxed);
+  return begin_time;
+}
+
+
+inline void ssybc::MiningStats::EndJob(std::chrono::steady_clock::time_point const begin_time, bool const is_solved)
+{
+  auto const duration_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::steady_clock::now() - begin_time).count();
+  finished_job_duration_ns_.fetch_add(duration_ns, std::memory_order_relaxed);
+  running_job_count_.fetch_sub(1, std::memory_order_relaxed);
+  if (is_solved) {
+    solved_block_count_.fetch_add(1, std::memory_order_relaxed);
+    last_time_to_solution_ns_.store(duration_ns, std::memory_order_relaxed);
+    total_time_to_solution_ns_.fetch_add(duration_ns, std::memory_order_relaxed);
+  }
+}
+
+
+inline void ssybc::MiningStats::AddAttempts(SizeT const worker_index, std::uint64_t const count)
+{
+  worker_attempt_counts_[static_cast<std::size_t>(worker_index % worker_count_)].value.fetch_add(
+    count,
+    std::memory_order_relaxed);
+}
+
+
+inline void ssybc::MiningStats::AddTimeStampRollover()
+{
+  time_stamp_rollover_count_.fetch_add(1, std::memory_order_relaxed);
+}
+
+
+#endif  // SSYBC_SRC_MINER_MINING_STATS_IMPL_HPP_
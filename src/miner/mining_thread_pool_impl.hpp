@@ -0,0 +1,220 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_SRC_MINER_MINING_THREAD_POOL_IMPL_HPP_
+#define SSYBC_SRC_MINER_MINING_THREAD_POOL_IMPL_HPP_
+
+#include "include/ssybc/miner/mining_thread_pool.hpp"
+#include "include/ssybc/logging/logging.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#ifdef SSYBC_HAS_PTHREAD_SETAFFINITY_NP
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+
+inline ssybc::MiningThreadPool::MiningThreadPool():
+  MiningThreadPool(std::max<SizeT>(1, std::thread::hardware_concurrency()))
+{ EMPTY_BLOCK }
+
+
+inline ssybc::MiningThreadPool::MiningThreadPool(SizeT const thread_count):
+  worker_count_{ std::max<SizeT>(1, thread_count) }
+{ EMPTY_BLOCK }
+
+
+inline ssybc::MiningThreadPool::MiningThreadPool(MiningThreadPoolConfig const & config)
+{
+  auto topology = CPUTopology::Current();
+  if (!config.cpu_ids.empty()) {
+    topology = topology.RestrictedTo(config.cpu_ids);
+    if (topology.LogicalCPUs().empty()) {
+      throw std::invalid_argument(
+        "Cannot create MiningThreadPool, none of the CPUs in cpu_ids is online and allowed for this process."
+      );
+    }
+  }
+  auto const core_count = topology.PhysicalCoreCount();
+  topology = topology.WithoutFirstCores(config.reserved_core_count);
+  if (config.skips_smt_siblings) {
+    topology = topology.WithoutSMTSiblings();
+  }
+  auto const cpu_ids = topology.CPUIds();
+  if (cpu_ids.empty()) {
+    throw std::invalid_argument(
+      "Cannot create MiningThreadPool, no CPU is left after reserving "
+      + std::to_string(config.reserved_core_count) + " of " + std::to_string(core_count) + " cores."
+    );
+  }
+
+  auto const thread_count = config.thread_count == 0 ? cpu_ids.size() : config.thread_count;
+  if (config.pins_workers) {
+#ifdef SSYBC_HAS_PTHREAD_SETAFFINITY_NP
+    for (SizeT i{ 0 }; i < thread_count; ++i) {
+      worker_cpu_ids_.push_back(cpu_ids[static_cast<std::size_t>(i % cpu_ids.size())]);
+    }
+#else
+    logging::warning << "Cannot pin mining workers, thread affinity is not supported on this platform." << std::endl;
+#endif
+  }
+  worker_count_ = std::max<SizeT>(1, thread_count);
+}
+
+
+inline ssybc::MiningThreadPool::~MiningThreadPool()
+{
+  Shutdown();
+}
+
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+
+inline auto ssybc::MiningThreadPool::Size() const -> SizeT
+{
+  return worker_count_;
+}
+
+
+inline auto ssybc::MiningThreadPool::WorkerCPUIds() const -> std::vector<SizeT>
+{
+  return worker_cpu_ids_;
+}
+
+
+inline void ssybc::MiningThreadPool::Run(std::function<void(SizeT const worker_index)> const & job)
+{
+  std::lock_guard<std::mutex> run_lock(run_mutex_);
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (is_shutdown_) {
+    throw std::logic_error("Cannot run a mining job on a MiningThreadPool that has been shut down.");
+  }
+  if (workers_.empty()) {
+    StartWorkers_();
+  }
+  job_ptr_ = &job;
+  running_worker_count_ = worker_count_;
+  ++job_generation_;
+  job_cv_.notify_all();
+  done_cv_.wait(lock, [this] { return running_worker_count_ == 0; });
+  job_ptr_ = nullptr;
+}
+
+
+inline void ssybc::MiningThreadPool::Shutdown()
+{
+  std::lock_guard<std::mutex> run_lock(run_mutex_);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (is_shutdown_) {
+      return;
+    }
+    is_shutdown_ = true;
+  }
+  job_cv_.notify_all();
+  for (auto &worker : workers_) {
+    worker.join();
+  }
+}
+
+
+inline bool ssybc::MiningThreadPool::IsShutdown() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return is_shutdown_;
+}
+
+
+inline auto ssybc::MiningThreadPool::Default() -> std::shared_ptr<MiningThreadPool>
+{
+  static auto const default_pool = std::make_shared<MiningThreadPool>();
+  return default_pool;
+}
+
+
+// -------------------------------------------------- Private Method --------------------------------------------------
+
+
+// Workers wait on "mutex_", held by Run(), until the first job is posted.
+inline void ssybc::MiningThreadPool::StartWorkers_()
+{
+  workers_.reserve(static_cast<std::size_t>(worker_count_));
+  for (SizeT i{ 0 }; i < worker_count_; ++i) {
+    workers_.push_back(std::thread(&MiningThreadPool::WorkerLoop_, this, i));
+  }
+}
+
+
+inline void ssybc::MiningThreadPool::WorkerLoop_(SizeT const worker_index)
+{
+  if (worker_index < worker_cpu_ids_.size()) {
+    auto const cpu_id = worker_cpu_ids_[static_cast<std::size_t>(worker_index)];
+    if (!PinCurrentThreadToCPU_(cpu_id)) {
+      logging::warning << "Cannot pin mining worker " + std::to_string(worker_index)
+        + " to CPU " + std::to_string(cpu_id) + "." << std::endl;
+    }
+  }
+  SizeT finished_generation{ 0 };
+  while (true) {
+    std::function<void(SizeT const)> const *job_ptr{ nullptr };
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      job_cv_.wait(lock, [&] { return is_shutdown_ || job_generation_ != finished_generation; });
+      if (job_generation_ == finished_generation) {
+        return;
+      }
+      finished_generation = job_generation_;
+      job_ptr = job_ptr_;
+    }
+
+    (*job_ptr)(worker_index);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (--running_worker_count_ == 0) {
+      done_cv_.notify_all();
+    }
+  }
+}
+
+
+inline bool ssybc::MiningThreadPool::PinCurrentThreadToCPU_(SizeT const cpu_id)
+{
+#ifdef SSYBC_HAS_PTHREAD_SETAFFINITY_NP
+  if (cpu_id >= CPU_SETSIZE) {
+    return false;
+  }
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  CPU_SET(static_cast<int>(cpu_id), &cpus);
+  return pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) == 0;
+#else
+  return false;
+#endif
+}
+
+
+#endif  // SSYBC_SRC_MINER_MINING_THREAD_POOL_IMPL_HPP_
@@ -0,0 +1,83 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_SRC_MINER_MINING_THROTTLE_IMPL_HPP_
+#define SSYBC_SRC_MINER_MINING_THROTTLE_IMPL_HPP_
+
+#include "include/ssybc/miner/mining_throttle.hpp"
+
+#include <algorithm>
+#include <thread>
+
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+
+inline bool ssybc::MiningThrottle::IsEnabled() const
+{
+  return cpu_share < 1.0 || max_hashes_per_second > 0.0;
+}
+
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+
+inline ssybc::MiningThrottlePacer::MiningThrottlePacer(MiningThrottle const & throttle, SizeT const worker_count):
+  is_enabled_{ throttle.IsEnabled() },
+  cpu_share_{ std::min(1.0, std::max(1e-3, throttle.cpu_share)) },
+  worker_hashes_per_second_{ throttle.max_hashes_per_second / static_cast<double>(std::max<SizeT>(1, worker_count)) },
+  start_time_{ std::chrono::steady_clock::now() },
+  resume_time_{ start_time_ }
+{ EMPTY_BLOCK }
+
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+
+inline void ssybc::MiningThrottlePacer::Pace(std::uint64_t const hash_count, MiningSession & session)
+{
+  if (!is_enabled_) {
+    return;
+  }
+  using Seconds = std::chrono::duration<double>;
+  auto const now = std::chrono::steady_clock::now();
+  busy_duration_ += now - resume_time_;
+  hash_count_ += hash_count;
+
+  Seconds allowed_elapsed{ Seconds(busy_duration_).count() / cpu_share_ };
+  if (worker_hashes_per_second_ > 0.0) {
+    allowed_elapsed = std::max(allowed_elapsed, Seconds(static_cast<double>(hash_count_) / worker_hashes_per_second_));
+  }
+  auto const resume_at = start_time_ + std::chrono::duration_cast<std::chrono::steady_clock::duration>(allowed_elapsed);
+
+  // Short naps, so a cancelled job is noticed soon even under a very low hash rate cap.
+  auto const max_nap = std::chrono::milliseconds(10);
+  while (!session.StopIfPastDeadline()) {
+    auto const remaining = resume_at - std::chrono::steady_clock::now();
+    if (remaining <= std::chrono::steady_clock::duration::zero()) {
+      break;
+    }
+    std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(remaining, max_nap));
+  }
+  resume_time_ = std::chrono::steady_clock::now();
+}
+
+
+#endif  // SSYBC_SRC_MINER_MINING_THROTTLE_IMPL_HPP_
@@ -0,0 +1,107 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_SRC_MINER_NONCE_DISPENSER_IMPL_HPP_
+#define SSYBC_SRC_MINER_NONCE_DISPENSER_IMPL_HPP_
+
+#include "include/ssybc/miner/nonce_dispenser.hpp"
+#include "include/ssybc/utility/utility.hpp"
+
+#include <algorithm>
+#include <limits>
+
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+
+inline ssybc::NonceDispenser::NonceDispenser(BlockTimeInterval const time_stamp, BlockNonce const batch_size):
+  NonceDispenser({ time_stamp, 0, std::numeric_limits<BlockNonce>::max() }, batch_size, true)
+{ EMPTY_BLOCK }
+
+
+inline ssybc::NonceDispenser::NonceDispenser(BlockTimeInterval const time_stamp):
+  NonceDispenser(time_stamp, kDefaultNonceBatchSize)
+{ EMPTY_BLOCK }
+
+
+inline ssybc::NonceDispenser::NonceDispenser(NonceBatch const &nonce_range, BlockNonce const batch_size):
+  NonceDispenser(nonce_range, batch_size, false)
+{ EMPTY_BLOCK }
+
+
+// The last batch of a round runs to the end of the range, so it can be up to twice the batch size.
+inline ssybc::NonceDispenser::NonceDispenser(
+  NonceBatch const &nonce_range,
+  BlockNonce const batch_size,
+  bool const rolls_over_time_stamp):
+  batch_size_{ std::max<BlockNonce>(1, batch_size) },
+  nonce_start_{ nonce_range.nonce_start },
+  nonce_end_{ std::max(nonce_range.nonce_start, nonce_range.nonce_end) },
+  batch_count_per_time_stamp_{
+    std::max<BlockNonce>(1, (nonce_end_ - nonce_start_) / std::max<BlockNonce>(1, batch_size))
+  },
+  first_time_stamp_{ nonce_range.time_stamp },
+  rolls_over_time_stamp_{ rolls_over_time_stamp }
+{ EMPTY_BLOCK }
+
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+
+inline auto ssybc::NonceDispenser::BatchSize() const -> BlockNonce
+{
+  return batch_size_;
+}
+
+
+inline auto ssybc::NonceDispenser::NextBatch() -> NonceBatch
+{
+  auto const batch_index = next_batch_index_.fetch_add(1, std::memory_order_relaxed);
+  auto const round = batch_index / batch_count_per_time_stamp_;
+  if (round > 0 && !rolls_over_time_stamp_) {
+    return { first_time_stamp_, nonce_end_, nonce_end_ };
+  }
+  auto const batch_index_in_round = batch_index % batch_count_per_time_stamp_;
+  bool const is_last_batch_in_round{ batch_index_in_round + 1 == batch_count_per_time_stamp_ };
+  auto const nonce_start = nonce_start_ + batch_index_in_round * batch_size_;
+  return {
+    round == 0 ? first_time_stamp_ : TimeStampOfRound_(round),
+    nonce_start,
+    is_last_batch_in_round ? nonce_end_ : nonce_start + batch_size_
+  };
+}
+
+
+// -------------------------------------------------- Private Method --------------------------------------------------
+
+
+// The first worker to reach a round picks its time stamp, every later one reads it.
+inline auto ssybc::NonceDispenser::TimeStampOfRound_(BlockNonce const round) -> BlockTimeInterval
+{
+  std::lock_guard<std::mutex> lock(time_stamps_mutex_);
+  while (time_stamps_.size() < round) {
+    auto const previous_time_stamp = time_stamps_.empty() ? first_time_stamp_ : time_stamps_.back();
+    time_stamps_.push_back(std::max<BlockTimeInterval>(util::UTCTime(), previous_time_stamp + 1));
+  }
+  return time_stamps_[static_cast<std::size_t>(round - 1)];
+}
+
+
+#endif  // SSYBC_SRC_MINER_NONCE_DISPENSER_IMPL_HPP_
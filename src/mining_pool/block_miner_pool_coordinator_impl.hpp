@@ -0,0 +1,136 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_SRC_MINING_POOL_BLOCK_MINER_POOL_COORDINATOR_IMPL_HPP_
+#define SSYBC_SRC_MINING_POOL_BLOCK_MINER_POOL_COORDINATOR_IMPL_HPP_
+
+#include "include/ssybc/mining_pool/block_miner_pool_coordinator.hpp"
+#include "include/ssybc/utility/utility.hpp"
+#include "include/ssybc/logging/logging.hpp"
+
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+
+template<typename Validator>
+inline ssybc::BlockMinerPoolCoordinator<Validator>::BlockMinerPoolCoordinator(std::string const &address):
+  BlockMinerPoolCoordinator(std::make_shared<MiningPoolCoordinator>(address))
+{ EMPTY_BLOCK }
+
+
+template<typename Validator>
+inline ssybc::BlockMinerPoolCoordinator<Validator>::BlockMinerPoolCoordinator(
+  std::shared_ptr<MiningPoolCoordinator> coordinator_ptr):
+  coordinator_ptr_{ coordinator_ptr }
+{ EMPTY_BLOCK }
+
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+
+template<typename Validator>
+inline auto ssybc::BlockMinerPoolCoordinator<Validator>::CoordinatorPtr() const
+  -> std::shared_ptr<MiningPoolCoordinator>
+{
+  return coordinator_ptr_;
+}
+
+
+template<typename Validator>
+inline auto ssybc::BlockMinerPoolCoordinator<Validator>::MineGenesisInfo(
+  BinaryData const & hashable_binary) const -> MinedResult
+{
+  MiningSession session{};
+  return MineGenesisInfo(hashable_binary, session);
+}
+
+
+template<typename Validator>
+inline auto ssybc::BlockMinerPoolCoordinator<Validator>::MineInfo(
+  BlockHash const & previous_hash,
+  BinaryData const & hashable_binary) const -> MinedResult
+{
+  MiningSession session{};
+  return MineInfo(previous_hash, hashable_binary, session);
+}
+
+
+template<typename Validator>
+inline auto ssybc::BlockMinerPoolCoordinator<Validator>::MineGenesisInfo(
+  BinaryData const & hashable_binary,
+  MiningSession & session) const -> MinedResult
+{
+  logging::info << "Mining Genesis block variables on mining pool..." << std::endl;
+  auto const result = MineOnPool_(true, BlockHash(), hashable_binary, session);
+  logging::info << "Finished mining Genesis block variables on mining pool." << std::endl;
+  return result;
+}
+
+
+template<typename Validator>
+inline auto ssybc::BlockMinerPoolCoordinator<Validator>::MineInfo(
+  BlockHash const & previous_hash,
+  BinaryData const & hashable_binary,
+  MiningSession & session) const -> MinedResult
+{
+  logging::info << "Mining block variables on mining pool..." << std::endl;
+  auto const result = MineOnPool_(false, previous_hash, hashable_binary, session);
+  logging::info << "Finished mining block variables on mining pool." << std::endl;
+  return result;
+}
+
+
+// -------------------------------------------------- Private Method --------------------------------------------------
+
+
+template<typename Validator>
+inline auto ssybc::BlockMinerPoolCoordinator<Validator>::MineOnPool_(
+  bool const is_genesis,
+  BlockHash const & previous_hash,
+  BinaryData const & hashable_binary,
+  MiningSession & session) const -> MinedResult
+{
+  auto const validator = Validator();
+  using HashCalculatorType = typename BlockMinerPoolCoordinator::HashCalculatorType;
+  auto const hash_calculator = HashCalculatorType();
+  auto const is_valid_hash = [&](BlockHash const &hash) {
+    return is_genesis ? validator.IsValidGenesisBlockHash(hash) : validator.IsValidHashToAppend(previous_hash, hash);
+  };
+  if (is_valid_hash(hash_calculator.Hash(hashable_binary))) {
+    MinedResult const result{
+      util::TrailingTimeStampBeforeNonceFromBinaryData(hashable_binary),
+      util::TrailingNonceFromBinaryData(hashable_binary)
+    };
+    session.PublishResult(result);
+    return result;
+  }
+
+  // Called with the coordinator's lock held, once per solution.
+  BinaryData candidate_binary{ hashable_binary };
+  auto const is_valid_result = [&](MinedResult const &result) {
+    util::UpdateBinaryDataWithTrailingTimeStampBeforeNonce(candidate_binary, result.time_stamp);
+    util::UpdateBinaryDataWithTrailingNonce(candidate_binary, result.nonce);
+    return is_valid_hash(hash_calculator.Hash(candidate_binary));
+  };
+  return coordinator_ptr_->Mine(is_genesis, previous_hash, hashable_binary, is_valid_result, session);
+}
+
+
+#endif  // SSYBC_SRC_MINING_POOL_BLOCK_MINER_POOL_COORDINATOR_IMPL_HPP_
@@ -0,0 +1,393 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_SRC_MINING_POOL_MINING_POOL_CONNECTION_IMPL_HPP_
+#define SSYBC_SRC_MINING_POOL_MINING_POOL_CONNECTION_IMPL_HPP_
+
+#include "include/ssybc/mining_pool/mining_pool_connection.hpp"
+#include "include/ssybc/utility/utility.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+
+// ----------------------------------------------------- Helper -------------------------------------------------------
+
+namespace ssybc {
+
+  struct MiningPoolSocketAddress_ {
+    bool is_unix;
+    // "host" and "port" for tcp addresses, "path" for unix addresses.
+    std::string host;
+    std::string port;
+    std::string path;
+  };
+
+  // Throws std::runtime_error if "address" is malformed.
+  MiningPoolSocketAddress_ MiningPoolSocketAddressFromString_(std::string const &address);
+  sockaddr_un UnixSocketAddressFromPath_(std::string const &path);
+  // Throws std::runtime_error if "host" and "port" do not resolve.
+  std::shared_ptr<addrinfo> ResolvedTCPAddresses_(MiningPoolSocketAddress_ const &address, bool const is_passive);
+  std::string SocketErrorString_(std::string const &what);
+
+#ifdef MSG_NOSIGNAL
+  constexpr int kMiningPoolSendFlags_{ MSG_NOSIGNAL };
+#else
+  constexpr int kMiningPoolSendFlags_{ 0 };
+#endif
+
+  constexpr SizeT kMiningPoolFrameHeaderSize_{ 1 + sizeof(std::uint32_t) };
+}
+
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+
+inline ssybc::MiningPoolConnection::MiningPoolConnection(int const socket_fd):
+  socket_fd_{ socket_fd }
+{
+#ifdef SO_NOSIGPIPE
+  int const option{ 1 };
+  setsockopt(socket_fd_, SOL_SOCKET, SO_NOSIGPIPE, &option, sizeof(option));
+#endif
+}
+
+
+inline ssybc::MiningPoolConnection::~MiningPoolConnection()
+{
+  close(socket_fd_);
+}
+
+
+inline ssybc::MiningPoolListener::MiningPoolListener(std::string const &address)
+{
+  auto const socket_address = MiningPoolSocketAddressFromString_(address);
+  if (socket_address.is_unix) {
+    auto const unix_address = UnixSocketAddressFromPath_(socket_address.path);
+    struct stat file_status{};
+    if (lstat(socket_address.path.c_str(), &file_status) == 0 && S_ISSOCK(file_status.st_mode)) {
+      unlink(socket_address.path.c_str());
+    }
+    socket_fd_ = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (socket_fd_ < 0
+      || bind(socket_fd_, reinterpret_cast<sockaddr const *>(&unix_address), sizeof(unix_address)) != 0
+      || listen(socket_fd_, SOMAXCONN) != 0) {
+      auto const message = SocketErrorString_("Cannot listen on \"" + address + "\"");
+      if (socket_fd_ >= 0) {
+        close(socket_fd_);
+      }
+      throw std::runtime_error(message);
+    }
+    address_ = address;
+    unix_socket_path_ = socket_address.path;
+    return;
+  }
+
+  auto const addresses_ptr = ResolvedTCPAddresses_(socket_address, true);
+  for (auto info = addresses_ptr.get(); info != nullptr; info = info->ai_next) {
+    socket_fd_ = socket(info->ai_family, info->ai_socktype, info->ai_protocol);
+    if (socket_fd_ < 0) {
+      continue;
+    }
+    int const option{ 1 };
+    setsockopt(socket_fd_, SOL_SOCKET, SO_REUSEADDR, &option, sizeof(option));
+    if (bind(socket_fd_, info->ai_addr, info->ai_addrlen) == 0 && listen(socket_fd_, SOMAXCONN) == 0) {
+      break;
+    }
+    close(socket_fd_);
+    socket_fd_ = -1;
+  }
+  if (socket_fd_ < 0) {
+    throw std::runtime_error(SocketErrorString_("Cannot listen on \"" + address + "\""));
+  }
+
+  sockaddr_storage bound_address{};
+  socklen_t bound_address_size{ sizeof(bound_address) };
+  getsockname(socket_fd_, reinterpret_cast<sockaddr *>(&bound_address), &bound_address_size);
+  auto const port = bound_address.ss_family == AF_INET6
+    ? ntohs(reinterpret_cast<sockaddr_in6 const *>(&bound_address)->sin6_port)
+    : ntohs(reinterpret_cast<sockaddr_in const *>(&bound_address)->sin_port);
+  address_ = "tcp://" + socket_address.host + ":" + std::to_string(port);
+}
+
+
+inline ssybc::MiningPoolListener::~MiningPoolListener()
+{
+  Close();
+  close(socket_fd_);
+}
+
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+
+inline auto ssybc::MiningPoolConnection::Connect(std::string const &address) -> std::shared_ptr<MiningPoolConnection>
+{
+  auto const socket_address = MiningPoolSocketAddressFromString_(address);
+  if (socket_address.is_unix) {
+    auto const unix_address = UnixSocketAddressFromPath_(socket_address.path);
+    int const socket_fd{ socket(AF_UNIX, SOCK_STREAM, 0) };
+    if (socket_fd < 0
+      || connect(socket_fd, reinterpret_cast<sockaddr const *>(&unix_address), sizeof(unix_address)) != 0) {
+      auto const message = SocketErrorString_("Cannot connect to \"" + address + "\"");
+      if (socket_fd >= 0) {
+        close(socket_fd);
+      }
+      throw std::runtime_error(message);
+    }
+    return std::make_shared<MiningPoolConnection>(socket_fd);
+  }
+
+  auto const addresses_ptr = ResolvedTCPAddresses_(socket_address, false);
+  for (auto info = addresses_ptr.get(); info != nullptr; info = info->ai_next) {
+    int const socket_fd{ socket(info->ai_family, info->ai_socktype, info->ai_protocol) };
+    if (socket_fd < 0) {
+      continue;
+    }
+    if (connect(socket_fd, info->ai_addr, info->ai_addrlen) == 0) {
+      // Messages are small and latency bound, a solution should not wait for more bytes to send.
+      int const option{ 1 };
+      setsockopt(socket_fd, IPPROTO_TCP, TCP_NODELAY, &option, sizeof(option));
+      return std::make_shared<MiningPoolConnection>(socket_fd);
+    }
+    close(socket_fd);
+  }
+  throw std::runtime_error(SocketErrorString_("Cannot connect to \"" + address + "\""));
+}
+
+
+inline void ssybc::MiningPoolConnection::Send(MiningPoolMessageType const type, BinaryData const &payload)
+{
+  if (payload.size() > kMiningPoolMaxPayloadSize) {
+    throw std::runtime_error("Mining pool message payload is too large.");
+  }
+  BinaryData frame(kMiningPoolFrameHeaderSize_ + payload.size());
+  frame[0] = static_cast<Byte>(type);
+  auto const payload_size = util::ToLittleEndian(static_cast<std::uint32_t>(payload.size()));
+  std::memcpy(frame.data() + 1, &payload_size, sizeof(payload_size));
+  std::copy(payload.begin(), payload.end(), frame.begin() + kMiningPoolFrameHeaderSize_);
+
+  std::lock_guard<std::mutex> lock(send_mutex_);
+  if (IsShutdown()) {
+    throw std::runtime_error("Cannot send mining pool message on a shut down connection.");
+  }
+  SizeT sent_size{ 0 };
+  while (sent_size < frame.size()) {
+    auto const result = send(
+      socket_fd_,
+      frame.data() + sent_size,
+      static_cast<std::size_t>(frame.size() - sent_size),
+      kMiningPoolSendFlags_);
+    if (result < 0 && errno == EINTR) {
+      continue;
+    }
+    if (result <= 0) {
+      throw std::runtime_error(SocketErrorString_("Cannot send mining pool message"));
+    }
+    sent_size += static_cast<SizeT>(result);
+  }
+}
+
+
+inline bool ssybc::MiningPoolConnection::Receive(MiningPoolMessage &message)
+{
+  Byte frame_header[kMiningPoolFrameHeaderSize_];
+  if (!ReceiveBytes_(frame_header, kMiningPoolFrameHeaderSize_)) {
+    return false;
+  }
+  auto const type = frame_header[0];
+  if (type < static_cast<Byte>(MiningPoolMessageType::kJob)
+    || type > static_cast<Byte>(MiningPoolMessageType::kStopJob)) {
+    throw std::runtime_error("Unknown mining pool message type " + std::to_string(type) + ".");
+  }
+  std::uint32_t payload_size{ 0 };
+  std::memcpy(&payload_size, frame_header + 1, sizeof(payload_size));
+  payload_size = util::ToLittleEndian(payload_size);
+  if (payload_size > kMiningPoolMaxPayloadSize) {
+    throw std::runtime_error("Mining pool message payload is too large.");
+  }
+  message.type = static_cast<MiningPoolMessageType>(type);
+  message.payload.resize(payload_size);
+  if (!ReceiveBytes_(message.payload.data(), payload_size)) {
+    if (IsShutdown()) {
+      return false;
+    }
+    throw std::runtime_error("Mining pool connection closed in the middle of a message.");
+  }
+  return true;
+}
+
+
+inline void ssybc::MiningPoolConnection::Shutdown()
+{
+  if (!is_shutdown_.exchange(true)) {
+    shutdown(socket_fd_, SHUT_RDWR);
+  }
+}
+
+
+inline bool ssybc::MiningPoolConnection::IsShutdown() const
+{
+  return is_shutdown_.load();
+}
+
+
+inline auto ssybc::MiningPoolListener::Address() const -> std::string
+{
+  return address_;
+}
+
+
+inline auto ssybc::MiningPoolListener::Accept() -> std::shared_ptr<MiningPoolConnection>
+{
+  while (!is_closed_.load()) {
+    int const socket_fd{ accept(socket_fd_, nullptr, nullptr) };
+    if (socket_fd < 0) {
+      if (errno == EINTR || errno == ECONNABORTED) {
+        continue;
+      }
+      if (is_closed_.load()) {
+        break;
+      }
+      throw std::runtime_error(SocketErrorString_("Cannot accept mining pool worker"));
+    }
+    if (is_closed_.load()) {
+      close(socket_fd);
+      break;
+    }
+    if (unix_socket_path_.empty()) {
+      int const option{ 1 };
+      setsockopt(socket_fd, IPPROTO_TCP, TCP_NODELAY, &option, sizeof(option));
+    }
+    return std::make_shared<MiningPoolConnection>(socket_fd);
+  }
+  return nullptr;
+}
+
+
+inline void ssybc::MiningPoolListener::Close()
+{
+  std::lock_guard<std::mutex> lock(close_mutex_);
+  if (is_closed_.exchange(true)) {
+    return;
+  }
+  shutdown(socket_fd_, SHUT_RDWR);
+  if (!unix_socket_path_.empty()) {
+    unlink(unix_socket_path_.c_str());
+  }
+}
+
+
+// -------------------------------------------------- Private Method --------------------------------------------------
+
+
+inline bool ssybc::MiningPoolConnection::ReceiveBytes_(Byte * const bytes, SizeT const size)
+{
+  SizeT received_size{ 0 };
+  while (received_size < size) {
+    auto const result = recv(socket_fd_, bytes + received_size, static_cast<std::size_t>(size - received_size), 0);
+    if (result < 0 && errno == EINTR) {
+      continue;
+    }
+    if (result == 0 || (result < 0 && IsShutdown())) {
+      return false;
+    }
+    if (result < 0) {
+      throw std::runtime_error(SocketErrorString_("Cannot receive mining pool message"));
+    }
+    received_size += static_cast<SizeT>(result);
+  }
+  return true;
+}
+
+
+// ----------------------------------------------------- Helper -------------------------------------------------------
+
+
+inline auto ssybc::MiningPoolSocketAddressFromString_(std::string const &address) -> MiningPoolSocketAddress_
+{
+  std::string const tcp_scheme{ "tcp://" };
+  std::string const unix_scheme{ "unix://" };
+  if (address.compare(0, unix_scheme.size(), unix_scheme) == 0 && address.size() > unix_scheme.size()) {
+    return { true, "", "", address.substr(unix_scheme.size()) };
+  }
+  if (address.compare(0, tcp_scheme.size(), tcp_scheme) == 0) {
+    auto const host_and_port = address.substr(tcp_scheme.size());
+    auto const colon_index = host_and_port.rfind(':');
+    if (colon_index != std::string::npos && colon_index > 0 && colon_index + 1 < host_and_port.size()) {
+      auto host = host_and_port.substr(0, colon_index);
+      // "[::1]:8333", brackets are only there to delimit the port.
+      if (host.size() > 2 && host.front() == '[' && host.back() == ']') {
+        host = host.substr(1, host.size() - 2);
+      }
+      return { false, host, host_and_port.substr(colon_index + 1), "" };
+    }
+  }
+  throw std::runtime_error("Malformed mining pool address \"" + address + "\".");
+}
+
+
+inline auto ssybc::UnixSocketAddressFromPath_(std::string const &path) -> sockaddr_un
+{
+  sockaddr_un unix_address{};
+  if (path.size() >= sizeof(unix_address.sun_path)) {
+    throw std::runtime_error("Unix socket path \"" + path + "\" is too long.");
+  }
+  unix_address.sun_family = AF_UNIX;
+  std::memcpy(unix_address.sun_path, path.c_str(), path.size() + 1);
+  return unix_address;
+}
+
+
+inline auto ssybc::ResolvedTCPAddresses_(
+  MiningPoolSocketAddress_ const &address,
+  bool const is_passive) -> std::shared_ptr<addrinfo>
+{
+  addrinfo hints{};
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  hints.ai_flags = is_passive ? AI_PASSIVE : 0;
+  addrinfo *addresses{ nullptr };
+  auto const result = getaddrinfo(address.host.c_str(), address.port.c_str(), &hints, &addresses);
+  if (result != 0) {
+    throw std::runtime_error(
+      "Cannot resolve \"" + address.host + ":" + address.port + "\": " + gai_strerror(result) + ".");
+  }
+  return std::shared_ptr<addrinfo>(addresses, freeaddrinfo);
+}
+
+
+inline auto ssybc::SocketErrorString_(std::string const &what) -> std::string
+{
+  return what + ": " + std::strerror(errno) + ".";
+}
+
+
+#endif  // SSYBC_SRC_MINING_POOL_MINING_POOL_CONNECTION_IMPL_HPP_
@@ -0,0 +1,286 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_SRC_MINING_POOL_MINING_POOL_COORDINATOR_IMPL_HPP_
+#define SSYBC_SRC_MINING_POOL_MINING_POOL_COORDINATOR_IMPL_HPP_
+
+#include "include/ssybc/mining_pool/mining_pool_coordinator.hpp"
+#include "include/ssybc/mining_pool/mining_pool_protocol.hpp"
+#include "include/ssybc/utility/utility.hpp"
+#include "include/ssybc/logging/logging.hpp"
+
+#include <exception>
+#include <stdexcept>
+
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+
+inline ssybc::MiningPoolCoordinator::MiningPoolCoordinator(std::string const &address):
+  MiningPoolCoordinator(address, kDefaultMiningPoolNonceRangeSize)
+{ EMPTY_BLOCK }
+
+
+inline ssybc::MiningPoolCoordinator::MiningPoolCoordinator(
+  std::string const &address,
+  BlockNonce const nonce_range_size):
+  nonce_range_size_{ nonce_range_size },
+  listener_{ address }
+{
+  accept_thread_ = std::thread([this] { AcceptWorkers_(); });
+  logging::info << "Mining pool coordinator listening on " + listener_.Address() + "." << std::endl;
+}
+
+
+inline ssybc::MiningPoolCoordinator::~MiningPoolCoordinator()
+{
+  Shutdown();
+}
+
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+
+inline auto ssybc::MiningPoolCoordinator::Address() const -> std::string
+{
+  return listener_.Address();
+}
+
+
+inline auto ssybc::MiningPoolCoordinator::NonceRangeSize() const -> BlockNonce
+{
+  return nonce_range_size_;
+}
+
+
+inline auto ssybc::MiningPoolCoordinator::WorkerCount() const -> SizeT
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  SizeT result{ 0 };
+  for (auto const &worker_ptr : worker_ptrs_) {
+    if (!worker_ptr->has_finished.load()) {
+      ++result;
+    }
+  }
+  return result;
+}
+
+
+inline auto ssybc::MiningPoolCoordinator::Mine(
+  bool const is_genesis,
+  BlockHash const &previous_hash,
+  BinaryData const &hashable_binary,
+  std::function<bool(MinedResult const &)> const &is_valid_result,
+  MiningSession &session) -> MinedResult
+{
+  std::lock_guard<std::mutex> job_lock(job_mutex_);
+  std::uint64_t job_id{ 0 };
+  SizeT worker_count{ 0 };
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (is_shutdown_) {
+      throw std::logic_error("Cannot mine with a mining pool coordinator that has been shut down.");
+    }
+    job_id = ++job_id_;
+    has_job_ = true;
+    job_template_payload_ = MiningPoolJobTemplatePayload(job_id, is_genesis, previous_hash, hashable_binary);
+    job_dispenser_ptr_.reset(new NonceDispenser(
+      util::TrailingTimeStampBeforeNonceFromBinaryData(hashable_binary),
+      nonce_range_size_));
+    job_session_ptr_ = &session;
+    job_is_valid_result_ = is_valid_result;
+    for (auto const &worker_ptr : worker_ptrs_) {
+      if (!worker_ptr->has_finished.load()) {
+        SendNextNonceRange_(*worker_ptr->connection_ptr);
+        ++worker_count;
+      }
+    }
+  }
+  logging::info << "Mining pool job " + util::ToString(job_id) + " sent to "
+    + util::ToString(worker_count) + " workers." << std::endl;
+
+  session.WaitUntilStopped();
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    has_job_ = false;
+    job_template_payload_.clear();
+    job_dispenser_ptr_.reset();
+    job_time_stamps_.clear();
+    job_session_ptr_ = nullptr;
+    job_is_valid_result_ = nullptr;
+    for (auto const &worker_ptr : worker_ptrs_) {
+      if (worker_ptr->has_finished.load()) {
+        continue;
+      }
+      try {
+        worker_ptr->connection_ptr->Send(MiningPoolMessageType::kStopJob, MiningPoolJobIdPayload(job_id));
+      } catch (std::exception const &) {
+        worker_ptr->connection_ptr->Shutdown();
+      }
+    }
+  }
+  logging::info << "Mining pool job " + util::ToString(job_id)
+    + (session.HasResult() ? " solved." : " stopped without result.") << std::endl;
+  return session.Result();
+}
+
+
+inline void ssybc::MiningPoolCoordinator::Shutdown()
+{
+  std::list<std::unique_ptr<Worker_>> worker_ptrs{};
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (is_shutdown_) {
+      return;
+    }
+    is_shutdown_ = true;
+    if (job_session_ptr_ != nullptr) {
+      job_session_ptr_->Stop();
+    }
+    listener_.Close();
+    for (auto const &worker_ptr : worker_ptrs_) {
+      worker_ptr->connection_ptr->Shutdown();
+    }
+  }
+  accept_thread_.join();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    worker_ptrs.swap(worker_ptrs_);
+  }
+  for (auto &worker_ptr : worker_ptrs) {
+    worker_ptr->thread.join();
+  }
+}
+
+
+inline bool ssybc::MiningPoolCoordinator::IsShutdown() const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return is_shutdown_;
+}
+
+
+// -------------------------------------------------- Private Method --------------------------------------------------
+
+
+inline void ssybc::MiningPoolCoordinator::AcceptWorkers_()
+{
+  try {
+    while (auto const connection_ptr = listener_.Accept()) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (is_shutdown_) {
+        connection_ptr->Shutdown();
+        break;
+      }
+      JoinFinishedWorkers_();
+      std::unique_ptr<Worker_> worker_ptr{ new Worker_() };
+      worker_ptr->connection_ptr = connection_ptr;
+      auto &worker = *worker_ptr;
+      worker.thread = std::thread([this, &worker] { ServeWorker_(worker); });
+      worker_ptrs_.push_back(std::move(worker_ptr));
+      logging::info << "Mining pool worker connected." << std::endl;
+      if (has_job_) {
+        SendNextNonceRange_(*connection_ptr);
+      }
+    }
+  } catch (std::exception const &error) {
+    logging::warning << "Mining pool coordinator stopped accepting workers: " + std::string(error.what()) << std::endl;
+  }
+}
+
+
+inline void ssybc::MiningPoolCoordinator::ServeWorker_(Worker_ &worker)
+{
+  MiningPoolMessage message{};
+  try {
+    while (worker.connection_ptr->Receive(message)) {
+      switch (message.type) {
+      case MiningPoolMessageType::kWorkRequest: {
+        auto const job_id = MiningPoolJobIdFromPayload(message.payload);
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (has_job_ && job_id == job_id_) {
+          SendNextNonceRange_(*worker.connection_ptr);
+        }
+        break;
+      }
+      case MiningPoolMessageType::kSolution: {
+        auto const solution = MiningPoolSolutionFromPayload(message.payload);
+        std::lock_guard<std::mutex> lock(mutex_);
+        HandleSolution_(solution);
+        break;
+      }
+      default:
+        throw std::runtime_error("Unexpected mining pool message from worker.");
+      }
+    }
+  } catch (std::exception const &error) {
+    logging::warning << "Dropping mining pool worker: " + std::string(error.what()) << std::endl;
+  }
+  worker.connection_ptr->Shutdown();
+  worker.has_finished.store(true);
+}
+
+
+inline void ssybc::MiningPoolCoordinator::SendNextNonceRange_(MiningPoolConnection &connection)
+{
+  auto const nonce_range = job_dispenser_ptr_->NextBatch();
+  job_time_stamps_.insert(nonce_range.time_stamp);
+  try {
+    connection.Send(MiningPoolMessageType::kJob, MiningPoolJobPayload(job_template_payload_, nonce_range));
+  } catch (std::exception const &) {
+    connection.Shutdown();
+  }
+}
+
+
+// Solutions of earlier jobs are dropped silently, they race with kStopJob. A solution with a time stamp no nonce range
+// of the job was handed out with is rejected even if it passes "job_is_valid_result_".
+inline void ssybc::MiningPoolCoordinator::HandleSolution_(MiningPoolSolution const &solution)
+{
+  if (!has_job_ || solution.job_id != job_id_) {
+    return;
+  }
+  if (job_time_stamps_.count(solution.result.time_stamp) == 0 || !job_is_valid_result_(solution.result)) {
+    logging::warning << "Mining pool rejected invalid solution: time stamp "
+      + util::ToString(solution.result.time_stamp)
+      + ", nonce "
+      + util::ToString(solution.result.nonce)
+      + "." << std::endl;
+    return;
+  }
+  job_session_ptr_->PublishResult(solution.result);
+}
+
+
+inline void ssybc::MiningPoolCoordinator::JoinFinishedWorkers_()
+{
+  for (auto iter = worker_ptrs_.begin(); iter != worker_ptrs_.end();) {
+    if ((*iter)->has_finished.load()) {
+      (*iter)->thread.join();
+      iter = worker_ptrs_.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+}
+
+
+#endif  // SSYBC_SRC_MINING_POOL_MINING_POOL_COORDINATOR_IMPL_HPP_
@@ -0,0 +1,181 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_SRC_MINING_POOL_MINING_POOL_PROTOCOL_IMPL_HPP_
+#define SSYBC_SRC_MINING_POOL_MINING_POOL_PROTOCOL_IMPL_HPP_
+
+#include "include/ssybc/mining_pool/mining_pool_protocol.hpp"
+#include "include/ssybc/utility/utility.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+
+// ----------------------------------------------------- Helper -------------------------------------------------------
+
+namespace ssybc {
+
+  template<typename T>
+  void AppendLittleEndianToBinaryData_(BinaryData &binary_data, T const value);
+
+  // Reads a T at "offset" and advances "offset" past it.
+  template<typename T>
+  T ReadLittleEndianFromBinaryData_(BinaryData const &binary_data, SizeT &offset);
+
+  void CheckMiningPoolPayloadFullyRead_(BinaryData const &payload, SizeT const offset);
+}
+
+
+// -------------------------------------------------- Public Function -------------------------------------------------
+
+
+inline auto ssybc::MiningPoolJobTemplatePayload(
+  std::uint64_t const job_id,
+  bool const is_genesis,
+  BlockHash const &previous_hash,
+  BinaryData const &hashable_binary) -> BinaryData
+{
+  BinaryData payload{};
+  payload.reserve(sizeof(job_id) + 1 + previous_hash.size() + sizeof(std::uint32_t) + hashable_binary.size());
+  AppendLittleEndianToBinaryData_(payload, job_id);
+  payload.push_back(is_genesis ? 1 : 0);
+  payload.insert(payload.end(), previous_hash.begin(), previous_hash.end());
+  AppendLittleEndianToBinaryData_(payload, static_cast<std::uint32_t>(hashable_binary.size()));
+  payload.insert(payload.end(), hashable_binary.begin(), hashable_binary.end());
+  return payload;
+}
+
+
+inline auto ssybc::MiningPoolJobPayload(
+  BinaryData const &job_template_payload,
+  NonceBatch const &nonce_range) -> BinaryData
+{
+  BinaryData payload{};
+  payload.reserve(job_template_payload.size() + sizeof(BlockTimeInterval) + 2 * sizeof(BlockNonce));
+  payload.insert(payload.end(), job_template_payload.begin(), job_template_payload.end());
+  AppendLittleEndianToBinaryData_(payload, nonce_range.time_stamp);
+  AppendLittleEndianToBinaryData_(payload, nonce_range.nonce_start);
+  AppendLittleEndianToBinaryData_(payload, nonce_range.nonce_end);
+  return payload;
+}
+
+
+inline auto ssybc::MiningPoolSolutionPayload(MiningPoolSolution const &solution) -> BinaryData
+{
+  BinaryData payload{};
+  AppendLittleEndianToBinaryData_(payload, solution.job_id);
+  AppendLittleEndianToBinaryData_(payload, solution.result.time_stamp);
+  AppendLittleEndianToBinaryData_(payload, solution.result.nonce);
+  return payload;
+}
+
+
+inline auto ssybc::MiningPoolJobIdPayload(std::uint64_t const job_id) -> BinaryData
+{
+  BinaryData payload{};
+  AppendLittleEndianToBinaryData_(payload, job_id);
+  return payload;
+}
+
+
+inline auto ssybc::MiningPoolJobFromPayload(BinaryData const &payload) -> MiningPoolJob
+{
+  SizeT offset{ 0 };
+  MiningPoolJob job{};
+  job.job_id = ReadLittleEndianFromBinaryData_<std::uint64_t>(payload, offset);
+  job.is_genesis = ReadLittleEndianFromBinaryData_<Byte>(payload, offset) != 0;
+  if (payload.size() - offset < job.previous_hash.size()) {
+    throw std::runtime_error("Mining pool job payload is truncated.");
+  }
+  job.previous_hash = BlockHash(payload.data() + offset, job.previous_hash.size());
+  offset += job.previous_hash.size();
+  auto const binary_size = ReadLittleEndianFromBinaryData_<std::uint32_t>(payload, offset);
+  if (payload.size() - offset < binary_size) {
+    throw std::runtime_error("Mining pool job payload is truncated.");
+  }
+  job.hashable_binary = BinaryData(payload.begin() + offset, payload.begin() + offset + binary_size);
+  offset += binary_size;
+  job.nonce_range.time_stamp = ReadLittleEndianFromBinaryData_<BlockTimeInterval>(payload, offset);
+  job.nonce_range.nonce_start = ReadLittleEndianFromBinaryData_<BlockNonce>(payload, offset);
+  job.nonce_range.nonce_end = ReadLittleEndianFromBinaryData_<BlockNonce>(payload, offset);
+  CheckMiningPoolPayloadFullyRead_(payload, offset);
+  if (job.hashable_binary.size() < sizeof(BlockTimeInterval) + sizeof(BlockNonce)) {
+    throw std::runtime_error("Mining pool job header template is too short.");
+  }
+  return job;
+}
+
+
+inline auto ssybc::MiningPoolSolutionFromPayload(BinaryData const &payload) -> MiningPoolSolution
+{
+  SizeT offset{ 0 };
+  MiningPoolSolution solution{};
+  solution.job_id = ReadLittleEndianFromBinaryData_<std::uint64_t>(payload, offset);
+  solution.result.time_stamp = ReadLittleEndianFromBinaryData_<BlockTimeInterval>(payload, offset);
+  solution.result.nonce = ReadLittleEndianFromBinaryData_<BlockNonce>(payload, offset);
+  CheckMiningPoolPayloadFullyRead_(payload, offset);
+  return solution;
+}
+
+
+inline auto ssybc::MiningPoolJobIdFromPayload(BinaryData const &payload) -> std::uint64_t
+{
+  SizeT offset{ 0 };
+  auto const job_id = ReadLittleEndianFromBinaryData_<std::uint64_t>(payload, offset);
+  CheckMiningPoolPayloadFullyRead_(payload, offset);
+  return job_id;
+}
+
+
+// ----------------------------------------------------- Helper -------------------------------------------------------
+
+
+template<typename T>
+inline void ssybc::AppendLittleEndianToBinaryData_(BinaryData &binary_data, T const value)
+{
+  auto const little_endian_value = util::ToLittleEndian(value);
+  auto const old_size = binary_data.size();
+  binary_data.resize(old_size + sizeof(T));
+  std::memcpy(binary_data.data() + old_size, &little_endian_value, sizeof(T));
+}
+
+
+template<typename T>
+inline T ssybc::ReadLittleEndianFromBinaryData_(BinaryData const &binary_data, SizeT &offset)
+{
+  if (offset > binary_data.size() || binary_data.size() - offset < sizeof(T)) {
+    throw std::runtime_error("Mining pool message payload is truncated.");
+  }
+  T little_endian_value{};
+  std::memcpy(&little_endian_value, binary_data.data() + offset, sizeof(T));
+  offset += sizeof(T);
+  return util::ToLittleEndian(little_endian_value);
+}
+
+
+inline void ssybc::CheckMiningPoolPayloadFullyRead_(BinaryData const &payload, SizeT const offset)
+{
+  if (offset != payload.size()) {
+    throw std::runtime_error("Mining pool message payload has trailing bytes.");
+  }
+}
+
+
+#endif  // SSYBC_SRC_MINING_POOL_MINING_POOL_PROTOCOL_IMPL_HPP_
@@ -0,0 +1,192 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_SRC_MINING_POOL_MINING_POOL_WORKER_IMPL_HPP_
+#define SSYBC_SRC_MINING_POOL_MINING_POOL_WORKER_IMPL_HPP_
+
+#include "include/ssybc/mining_pool/mining_pool_worker.hpp"
+#include "include/ssybc/miner/block_miner_cpu_brute_force.hpp"
+#include "include/ssybc/utility/utility.hpp"
+#include "include/ssybc/logging/logging.hpp"
+
+#include <exception>
+#include <stdexcept>
+
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+
+template<typename Validator>
+inline ssybc::MiningPoolWorker<Validator>::MiningPoolWorker(std::string const &address):
+  MiningPoolWorker(address, std::make_shared<BlockMinerCPUBruteForce<Validator>>())
+{ EMPTY_BLOCK }
+
+
+template<typename Validator>
+inline ssybc::MiningPoolWorker<Validator>::MiningPoolWorker(
+  std::string const &address,
+  std::shared_ptr<BlockMiner<Validator>> miner_ptr):
+  address_{ address },
+  miner_ptr_{ miner_ptr }
+{ EMPTY_BLOCK }
+
+
+template<typename Validator>
+inline ssybc::MiningPoolWorker<Validator>::~MiningPoolWorker()
+{
+  Stop();
+  StopMining_();
+}
+
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+
+template<typename Validator>
+inline void ssybc::MiningPoolWorker<Validator>::Run()
+{
+  auto const connection_ptr = MiningPoolConnection::Connect(address_);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (is_stopped_) {
+      return;
+    }
+    connection_ptr_ = connection_ptr;
+  }
+  logging::info << "Mining pool worker connected to " + address_ + "." << std::endl;
+
+  MiningPoolMessage message{};
+  try {
+    while (connection_ptr->Receive(message)) {
+      switch (message.type) {
+      case MiningPoolMessageType::kJob:
+        StartMining_(MiningPoolJobFromPayload(message.payload));
+        break;
+      case MiningPoolMessageType::kStopJob: {
+        auto const job_id = MiningPoolJobIdFromPayload(message.payload);
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (session_ptr_ && session_job_id_ == job_id) {
+          session_ptr_->Stop();
+        }
+        break;
+      }
+      default:
+        throw std::runtime_error("Unexpected mining pool message from coordinator.");
+      }
+    }
+  } catch (std::exception const &error) {
+    logging::warning << "Mining pool worker disconnecting: " + std::string(error.what()) << std::endl;
+  }
+
+  StopMining_();
+  connection_ptr->Shutdown();
+  logging::info << "Mining pool worker disconnected from " + address_ + "." << std::endl;
+}
+
+
+template<typename Validator>
+inline void ssybc::MiningPoolWorker<Validator>::Stop()
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  is_stopped_ = true;
+  if (connection_ptr_) {
+    connection_ptr_->Shutdown();
+  }
+  if (session_ptr_) {
+    session_ptr_->Stop();
+  }
+}
+
+
+template<typename Validator>
+inline auto ssybc::MiningPoolWorker<Validator>::SolutionCount() const -> SizeT
+{
+  return solution_count_.load();
+}
+
+
+// -------------------------------------------------- Private Method --------------------------------------------------
+
+
+// A new range of the same job only arrives once the previous one is exhausted, so stopping is free then.
+template<typename Validator>
+inline void ssybc::MiningPoolWorker<Validator>::StartMining_(MiningPoolJob const &job)
+{
+  StopMining_();
+  std::lock_guard<std::mutex> lock(mutex_);
+  session_ptr_ = std::make_shared<MiningSession>(job.nonce_range);
+  session_job_id_ = job.job_id;
+  if (is_stopped_) {
+    session_ptr_->Stop();
+  }
+  mining_thread_ = std::thread(&MiningPoolWorker::MineNonceRange_, this, connection_ptr_, session_ptr_, job);
+}
+
+
+template<typename Validator>
+inline void ssybc::MiningPoolWorker<Validator>::StopMining_()
+{
+  std::thread mining_thread{};
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (session_ptr_) {
+      session_ptr_->Stop();
+    }
+    mining_thread.swap(mining_thread_);
+  }
+  if (mining_thread.joinable()) {
+    mining_thread.join();
+  }
+}
+
+
+template<typename Validator>
+inline void ssybc::MiningPoolWorker<Validator>::MineNonceRange_(
+  std::shared_ptr<MiningPoolConnection> const connection_ptr,
+  std::shared_ptr<MiningSession> const session_ptr,
+  MiningPoolJob const job)
+{
+  auto hashable_binary = job.hashable_binary;
+  util::UpdateBinaryDataWithTrailingTimeStampBeforeNonce(hashable_binary, job.nonce_range.time_stamp);
+  try {
+    if (job.is_genesis) {
+      miner_ptr_->MineGenesisInfo(hashable_binary, *session_ptr);
+    } else {
+      miner_ptr_->MineInfo(job.previous_hash, hashable_binary, *session_ptr);
+    }
+    if (session_ptr->HasResult()) {
+      ++solution_count_;
+      connection_ptr->Send(
+        MiningPoolMessageType::kSolution,
+        MiningPoolSolutionPayload({ job.job_id, session_ptr->Result() }));
+    } else if (!session_ptr->IsStopped()) {
+      connection_ptr->Send(MiningPoolMessageType::kWorkRequest, MiningPoolJobIdPayload(job.job_id));
+    }
+  } catch (std::exception const &error) {
+    if (!connection_ptr->IsShutdown()) {
+      logging::warning << "Mining pool worker cannot mine job " + util::ToString(job.job_id) + ": "
+        + std::string(error.what()) << std::endl;
+      connection_ptr->Shutdown();
+    }
+  }
+}
+
+
+#endif  // SSYBC_SRC_MINING_POOL_MINING_POOL_WORKER_IMPL_HPP_
@@ -33,6 +33,7 @@
 #include <type_traits>
 #include <ctime>
 #include <cstring>
+#include <stdexcept>
 
 
  // ----------------------------------------------------- Helper ------------------------------------------------------
@@ -193,13 +194,44 @@ inline std::string ssybc::util::HexStringFromBytes(BinaryData const &bytes, std:
 }
 
 
-inline ssybc::BlockHash ssybc::util::HashStrippedLeadingZeros(BlockHash const &hash)
+inline std::string ssybc::util::HexStringFromBytes(BlockHash const &hash)
+{
+  return HexStringFromBytes(hash, "");
+}
+
+
+inline std::string ssybc::util::HexStringFromBytes(BlockHash const &hash, std::string const delimiter)
+{
+  return HexStringFromBytes(hash.Binary(), delimiter);
+}
+
+
+inline ssybc::BinaryData ssybc::util::BytesFromHexString(std::string const &hex_string)
+{
+  auto const nibble_from_char = [&hex_string](char const c) -> Byte {
+    if (c >= '0' && c <= '9') { return static_cast<Byte>(c - '0'); }
+    if (c >= 'a' && c <= 'f') { return static_cast<Byte>(c - 'a' + 10); }
+    if (c >= 'A' && c <= 'F') { return static_cast<Byte>(c - 'A' + 10); }
+    throw std::invalid_argument("Cannot convert \"" + hex_string + "\" to bytes, it is not a hex string.");
+  };
+  if (hex_string.size() % 2 != 0) {
+    throw std::invalid_argument("Cannot convert \"" + hex_string + "\" to bytes, it has an odd number of digits.");
+  }
+  BinaryData result(hex_string.size() / 2);
+  for (std::size_t i{ 0 }; i < result.size(); ++i) {
+    result[i] = static_cast<Byte>((nibble_from_char(hex_string[i * 2]) << 4) | nibble_from_char(hex_string[i * 2 + 1]));
+  }
+  return result;
+}
+
+
+inline ssybc::BinaryData ssybc::util::HashStrippedLeadingZeros(BlockHash const &hash)
 {
   auto iter = hash.begin();
-  while (*iter == 0) {
+  while (iter != hash.end() && *iter == 0) {
     ++iter;
   }
-  return BlockHash{iter, hash.end()};
+  return BinaryData{iter, hash.end()};
 }
 
 
@@ -232,26 +264,35 @@ inline void ssybc::util::UpdateBinaryDataWithTrailingTimeStampBeforeNonce(
   BinaryData & binary_data,
   BlockTimeInterval const time_stamp)
 {
-  BinaryDataConverterDefault<BlockTimeInterval> ts_converter{};
-  BinaryDataConverterDefault<BlockNonce> nonce_converter{};
-  auto time_stamp_as_binary = ts_converter.BinaryDataFromData(time_stamp);
-  std::size_t const nonce_binary_size{ nonce_converter.BinaryDataFromData(BlockNonce{}).size() };
-  std::size_t const time_stamp_binary_size{ time_stamp_as_binary.size() };
-  std::size_t const binary_start_idx{ binary_data.size() - time_stamp_binary_size - nonce_binary_size };
-  for (size_t i{ 0 }; i < time_stamp_binary_size; ++i) {
-    binary_data[binary_start_idx + i] = time_stamp_as_binary[i];
-  }
+  UpdateBytesWithTrailingTimeStampBeforeNonce(binary_data.data(), binary_data.size(), time_stamp);
 }
 
 
 inline void ssybc::util::UpdateBinaryDataWithTrailingNonce(BinaryData & binary_data, BlockNonce const nonce)
 {
-  BinaryDataConverterDefault<BlockNonce> converter{};
-  auto nonce_as_binary = converter.BinaryDataFromData(nonce);
-  size_t const nonce_binary_size{ nonce_as_binary.size() };
-  size_t const binary_start_idx{ binary_data.size() - nonce_binary_size };
-  for (size_t i{ 0 }; i < nonce_binary_size; ++i) {
-    binary_data[binary_start_idx + i] = nonce_as_binary[i];
+  UpdateBytesWithTrailingNonce(binary_data.data(), binary_data.size(), nonce);
+}
+
+
+inline void ssybc::util::UpdateBytesWithTrailingTimeStampBeforeNonce(
+  Byte * const bytes,
+  SizeT const size,
+  BlockTimeInterval const time_stamp)
+{
+  // Written in place as little-endian bytes, same as BinaryDataConverterDefault, without temporary buffers.
+  auto const time_stamp_bits = static_cast<uint64_t>(time_stamp);
+  Byte * const destination{ bytes + size - sizeof(BlockTimeInterval) - sizeof(BlockNonce) };
+  for (std::size_t i{ 0 }; i < sizeof(BlockTimeInterval); ++i) {
+    destination[i] = static_cast<Byte>(time_stamp_bits >> (i * kNumberOfBitsInByte));
+  }
+}
+
+
+inline void ssybc::util::UpdateBytesWithTrailingNonce(Byte * const bytes, SizeT const size, BlockNonce const nonce)
+{
+  Byte * const destination{ bytes + size - sizeof(BlockNonce) };
+  for (std::size_t i{ 0 }; i < sizeof(BlockNonce); ++i) {
+    destination[i] = static_cast<Byte>(nonce >> (i * kNumberOfBitsInByte));
   }
 }
 
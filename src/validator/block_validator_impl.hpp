@@ -24,6 +24,11 @@
 
 #include "include/ssybc/validator/block_validator.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <typeindex>
+#include <typeinfo>
+
 
 // --------------------------------------------------- Public Method --------------------------------------------------
 
@@ -33,20 +38,24 @@ inline bool ssybc::BlockValidator<BlockT, Difficulty>::IsBlockPreAdjacentTo(
   BlockT const & lhs,
   BlockT const & rhs) const
 {
-  if (lhs.Header().Index() != (rhs.Header().Index() - 1)) { return false;  }
-  if (lhs.Header().TimeStamp() > rhs.Header().TimeStamp()) { return false; }
-  if (lhs.Header().Hash() != rhs.Header().PreviousHash()) { return false; }
-  return true;
+  return IsHeaderPreAdjacentTo_(lhs.Header(), rhs.Header());
 }
 
 
 template<typename BlockT, ssybc::HashDifficulty Difficulty>
 inline bool ssybc::BlockValidator<BlockT, Difficulty>::IsValidGenesisBlock(BlockT const & block) const
 {
+  auto const &header = block.Header();
+  if (header.Index() != 0) {
+    return false;
+  }
+  if (validation_cache_ptr_ != nullptr) {
+    return IsValidHeaderCached_(header);
+  }
   bool const is_hash_valid {
-    block.Header().PreviousHash() == typename BlockT::HeaderHashCalculatorType().GenesisBlockPreviousHash()
+    header.PreviousHash() == typename BlockT::HeaderHashCalculatorType().GenesisBlockPreviousHash()
   };
-  return block.Header().Index() == 0 && is_hash_valid && IsValidGenesisBlockHash(block.Header().Hash());
+  return is_hash_valid && IsValidGenesisBlockHash(header.Hash());
 }
 
 
@@ -55,9 +64,230 @@ inline bool ssybc::BlockValidator<BlockT, Difficulty>::IsValidToAppend(
   BlockT const & previous_block,
   BlockT const & block) const
 {
-  return
-    IsBlockPreAdjacentTo(previous_block, block)
-    && IsValidHashToAppend(previous_block.Header().Hash(), block.Header().Hash());
+  if (!IsBlockPreAdjacentTo(previous_block, block)) {
+    return false;
+  }
+  if (validation_cache_ptr_ != nullptr) {
+    return IsValidHeaderCached_(block.Header());
+  }
+  return IsValidHashToAppend(previous_block.Header().Hash(), block.Header().Hash());
+}
+
+
+template<typename BlockT, ssybc::HashDifficulty Difficulty>
+inline void ssybc::BlockValidator<BlockT, Difficulty>::SetValidationCachePtr(
+  std::shared_ptr<ValidationCache<BlockHeaderType>> const & cache_ptr)
+{
+  validation_cache_ptr_ = cache_ptr;
+}
+
+
+template<typename BlockT, ssybc::HashDifficulty Difficulty>
+inline auto ssybc::BlockValidator<BlockT, Difficulty>::ValidationCachePtr() const
+  -> std::shared_ptr<ValidationCache<BlockHeaderType>>
+{
+  return validation_cache_ptr_;
+}
+
+
+template<typename BlockT, ssybc::HashDifficulty Difficulty>
+template<typename BlockOrHeaderT>
+inline auto ssybc::BlockValidator<BlockT, Difficulty>::FirstInvalidIndex(
+  std::vector<BlockOrHeaderT> const & blocks) const -> SizeT
+{
+  return FirstInvalidIndex_(nullptr, blocks, nullptr);
+}
+
+
+template<typename BlockT, ssybc::HashDifficulty Difficulty>
+template<typename BlockOrHeaderT>
+inline auto ssybc::BlockValidator<BlockT, Difficulty>::FirstInvalidIndex(
+  BlockOrHeaderT const & previous_block,
+  std::vector<BlockOrHeaderT> const & blocks) const -> SizeT
+{
+  return FirstInvalidIndex_(&HeaderOf_(previous_block), blocks, nullptr);
+}
+
+
+template<typename BlockT, ssybc::HashDifficulty Difficulty>
+template<typename BlockOrHeaderT>
+inline auto ssybc::BlockValidator<BlockT, Difficulty>::FirstInvalidIndex(
+  std::vector<BlockOrHeaderT> const & blocks,
+  MiningThreadPool & thread_pool) const -> SizeT
+{
+  return FirstInvalidIndex_(nullptr, blocks, &thread_pool);
+}
+
+
+template<typename BlockT, ssybc::HashDifficulty Difficulty>
+template<typename BlockOrHeaderT>
+inline auto ssybc::BlockValidator<BlockT, Difficulty>::FirstInvalidIndex(
+  BlockOrHeaderT const & previous_block,
+  std::vector<BlockOrHeaderT> const & blocks,
+  MiningThreadPool & thread_pool) const -> SizeT
+{
+  return FirstInvalidIndex_(&HeaderOf_(previous_block), blocks, &thread_pool);
+}
+
+
+// -------------------------------------------------- Private Method --------------------------------------------------
+
+
+// Only headers without a cached verdict are hashed, all at once, in chunks that fill the SIMD lanes of
+// HashBatchInto(), on the workers of the thread pool if there is one. What is left only compares fields of
+// neighbouring headers.
+template<typename BlockT, ssybc::HashDifficulty Difficulty>
+template<typename BlockOrHeaderT>
+inline auto ssybc::BlockValidator<BlockT, Difficulty>::FirstInvalidIndex_(
+  BlockHeaderType const * previous_header_ptr,
+  std::vector<BlockOrHeaderT> const & blocks,
+  MiningThreadPool * thread_pool_ptr) const -> SizeT
+{
+  auto const block_count = static_cast<SizeT>(blocks.size());
+  std::vector<char> is_cached(blocks.size(), 0);
+  std::vector<char> cached_verdicts(blocks.size(), 0);
+  std::vector<SizeT> uncached_indices{};
+  uncached_indices.reserve(blocks.size());
+  std::type_index const validator_type{ typeid(*this) };
+  for (SizeT i{ 0 }; i < block_count; ++i) {
+    bool is_valid{ false };
+    bool const has_verdict{
+      validation_cache_ptr_ != nullptr && validation_cache_ptr_->Lookup(validator_type, HeaderOf_(blocks[i]), is_valid)
+    };
+    if (has_verdict) {
+      is_cached[i] = 1;
+      cached_verdicts[i] = static_cast<char>(is_valid);
+    } else {
+      uncached_indices.push_back(i);
+    }
+  }
+
+  auto const hash_count = static_cast<SizeT>(uncached_indices.size());
+  std::vector<BlockHash> hashes(uncached_indices.size());
+  if (thread_pool_ptr == nullptr || hash_count <= kBatchValidationChunkSize) {
+    BinaryData buffer{};
+    for (SizeT begin{ 0 }; begin < hash_count; begin += kBatchValidationChunkSize) {
+      auto const end = std::min(begin + kBatchValidationChunkSize, hash_count);
+      HashHeaders_(blocks, uncached_indices, begin, end, buffer, hashes.data());
+    }
+  } else {
+    std::atomic<SizeT> next_index{ 0 };
+    thread_pool_ptr->Run([&](SizeT const) {
+      BinaryData buffer{};
+      SizeT begin{ next_index.fetch_add(kBatchValidationChunkSize) };
+      while (begin < hash_count) {
+        auto const end = std::min(begin + kBatchValidationChunkSize, hash_count);
+        HashHeaders_(blocks, uncached_indices, begin, end, buffer, hashes.data());
+        begin = next_index.fetch_add(kBatchValidationChunkSize);
+      }
+    });
+  }
+
+  SizeT next_hash_index{ 0 };
+  for (SizeT i{ 0 }; i < block_count; ++i) {
+    auto const &header = HeaderOf_(blocks[i]);
+    bool is_valid_header{ cached_verdicts[i] != 0 };
+    if (is_cached[i] == 0) {
+      is_valid_header = IsValidHeader_(header, hashes[next_hash_index++]);
+      if (validation_cache_ptr_ != nullptr) {
+        validation_cache_ptr_->Insert(validator_type, header, is_valid_header);
+      }
+    }
+    bool const is_linked{
+      i == 0 && previous_header_ptr == nullptr
+      ? header.Index() == 0
+      : IsHeaderPreAdjacentTo_(i == 0 ? *previous_header_ptr : HeaderOf_(blocks[i - 1]), header)
+    };
+    if (!is_valid_header || !is_linked) {
+      return i;
+    }
+  }
+  return block_count;
+}
+
+
+template<typename BlockT, ssybc::HashDifficulty Difficulty>
+inline bool ssybc::BlockValidator<BlockT, Difficulty>::IsValidHeader_(
+  BlockHeaderType const & header,
+  BlockHash const & hash) const
+{
+  if (hash != header.Hash()) {
+    return false;
+  }
+  if (header.Index() == 0) {
+    return
+      header.PreviousHash() == typename BlockT::HeaderHashCalculatorType().GenesisBlockPreviousHash()
+      && IsValidGenesisBlockHash(hash);
+  }
+  return IsValidHashToAppend(header.PreviousHash(), hash);
+}
+
+
+template<typename BlockT, ssybc::HashDifficulty Difficulty>
+inline bool ssybc::BlockValidator<BlockT, Difficulty>::IsValidHeaderCached_(BlockHeaderType const & header) const
+{
+  bool is_valid{ false };
+  if (validation_cache_ptr_->Lookup(typeid(*this), header, is_valid)) {
+    return is_valid;
+  }
+  is_valid = IsValidHeader_(header, typename BlockT::HeaderHashCalculatorType().Hash(header.Binary()));
+  validation_cache_ptr_->Insert(typeid(*this), header, is_valid);
+  return is_valid;
+}
+
+
+template<typename BlockT, ssybc::HashDifficulty Difficulty>
+inline bool ssybc::BlockValidator<BlockT, Difficulty>::IsHeaderPreAdjacentTo_(
+  BlockHeaderType const & lhs,
+  BlockHeaderType const & rhs)
+{
+  if (lhs.Index() != (rhs.Index() - 1)) { return false;  }
+  if (lhs.TimeStamp() > rhs.TimeStamp()) { return false; }
+  if (lhs.Hash() != rhs.PreviousHash()) { return false; }
+  return true;
+}
+
+
+template<typename BlockT, ssybc::HashDifficulty Difficulty>
+template<typename BlockOrHeaderT>
+inline void ssybc::BlockValidator<BlockT, Difficulty>::HashHeaders_(
+  std::vector<BlockOrHeaderT> const & blocks,
+  std::vector<SizeT> const & indices,
+  SizeT const begin,
+  SizeT const end,
+  BinaryData & buffer,
+  BlockHash * const hashes)
+{
+  auto const size_of_header = BlockHeaderType::SizeOfBinary();
+  buffer.resize(static_cast<std::size_t>((end - begin) * size_of_header));
+  std::vector<Byte const *> messages{};
+  messages.reserve(static_cast<std::size_t>(end - begin));
+  for (SizeT i{ begin }; i < end; ++i) {
+    auto const header_binary = HeaderOf_(blocks[indices[i]]).Binary();
+    auto const message = buffer.data() + (i - begin) * size_of_header;
+    std::copy(header_binary.begin(), header_binary.end(), message);
+    messages.push_back(message);
+  }
+  typename BlockT::HeaderHashCalculatorType().HashBatchInto(
+    messages.data(),
+    static_cast<SizeT>(messages.size()),
+    size_of_header,
+    hashes + begin);
+}
+
+
+template<typename BlockT, ssybc::HashDifficulty Difficulty>
+inline auto ssybc::BlockValidator<BlockT, Difficulty>::HeaderOf_(BlockT const & block) -> BlockHeaderType const &
+{
+  return block.Header();
+}
+
+
+template<typename BlockT, ssybc::HashDifficulty Difficulty>
+inline auto ssybc::BlockValidator<BlockT, Difficulty>::HeaderOf_(
+  BlockHeaderType const & header) -> BlockHeaderType const &
+{
+  return header;
 }
 
 
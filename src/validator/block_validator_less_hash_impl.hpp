@@ -23,20 +23,27 @@
 #define SSYBC_SRC_VALIDATOR_BLOCK_VALIDATOR_LESS_HASH_IMPL_HPP_
 
 #include "include/ssybc/validator/block_validator_less_hash.hpp"
-#include "include/ssybc/utility/operator.hpp"
-#include <limits>
 
 
-template<typename BlockT, ssybc::HashDifficulty Difficulty>
-inline ssybc::BlockValidatorLessHash<BlockT, Difficulty>::BlockValidatorLessHash():
-  BlockValidator<BlockT, Difficulty>()
-{
-  auto const byte_max{ std::numeric_limits<Byte>::max() };
-  auto max_hash = BlockHash(typename BlockT::HeaderHashCalculatorType().SizeOfHashInBytes());
-  for (std::size_t i{ Difficulty }; i < max_hash.size(); ++i) {
-    max_hash[i] = byte_max;
-  }
-  max_hash_ = max_hash;
+// --------------------------------------------------- Helper Method --------------------------------------------------
+
+
+namespace ssybc {
+
+  // Bitwise OR of the first "Count" bytes, unrolled at compile time.
+  template<std::size_t Count>
+  struct LeadingBytesOr_ {
+    static Byte Of(Byte const *bytes)
+    {
+      return static_cast<Byte>(LeadingBytesOr_<Count - 1>::Of(bytes) | bytes[Count - 1]);
+    }
+  };
+
+  template<>
+  struct LeadingBytesOr_<0> {
+    static Byte Of(Byte const *) { return 0; }
+  };
+
 }
 
 
@@ -46,7 +53,7 @@ inline ssybc::BlockValidatorLessHash<BlockT, Difficulty>::BlockValidatorLessHash
 template<typename BlockT, ssybc::HashDifficulty Difficulty>
 inline bool ssybc::BlockValidatorLessHash<BlockT, Difficulty>::IsValidGenesisBlockHash(BlockHash const & hash) const
 {
-  return hash <= max_hash_;
+  return LeadingBytesOr_<Difficulty>::Of(hash.data()) == 0;
 }
 
 
@@ -55,7 +62,7 @@ inline bool ssybc::BlockValidatorLessHash<BlockT, Difficulty>::IsValidHashToAppe
   BlockHash const & previous_hash,
   BlockHash const & hash) const
 {
-  return hash < previous_hash;
+  return hash.Compare(previous_hash) < 0;
 }
 
 
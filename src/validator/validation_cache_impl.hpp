@@ -0,0 +1,172 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+#ifndef SSYBC_SRC_VALIDATOR_VALIDATION_CACHE_IMPL_HPP_
+#define SSYBC_SRC_VALIDATOR_VALIDATION_CACHE_IMPL_HPP_
+
+#include "include/ssybc/validator/validation_cache.hpp"
+
+#include <algorithm>
+#include <functional>
+
+
+// --------------------------------------------- Constructor & Destructor ---------------------------------------------
+
+
+template<typename BlockHeaderT>
+inline ssybc::ValidationCache<BlockHeaderT>::ValidationCache():
+  ValidationCache(kDefaultValidationCacheCapacityInBytes)
+{ EMPTY_BLOCK }
+
+
+template<typename BlockHeaderT>
+inline ssybc::ValidationCache<BlockHeaderT>::ValidationCache(SizeT const capacity_in_bytes):
+  shard_capacity_{ std::max<SizeT>(capacity_in_bytes / SizeOfEntry() / kValidationCacheShardCount, 1) }
+{ EMPTY_BLOCK }
+
+
+// --------------------------------------------------- Public Method --------------------------------------------------
+
+
+template<typename BlockHeaderT>
+inline bool ssybc::ValidationCache<BlockHeaderT>::Lookup(
+  std::type_index const &validator_type,
+  BlockHeaderT const &header,
+  bool &is_valid) const
+{
+  Key_ const key{ header.Hash(), validator_type };
+  auto &shard = ShardOf_(key.header_hash);
+  {
+    std::lock_guard<std::mutex> const lock{ shard.mutex };
+    auto const iter = shard.entry_dict.find(key);
+    if (iter != shard.entry_dict.end() && iter->second.header == header) {
+      is_valid = iter->second.is_valid;
+      ++hit_count_;
+      return true;
+    }
+  }
+  ++miss_count_;
+  return false;
+}
+
+
+template<typename BlockHeaderT>
+inline void ssybc::ValidationCache<BlockHeaderT>::Insert(
+  std::type_index const &validator_type,
+  BlockHeaderT const &header,
+  bool const is_valid)
+{
+  Key_ const key{ header.Hash(), validator_type };
+  auto &shard = ShardOf_(key.header_hash);
+  std::lock_guard<std::mutex> const lock{ shard.mutex };
+  auto const iter = shard.entry_dict.find(key);
+  if (iter != shard.entry_dict.end()) {
+    shard.entry_dict.erase(iter);
+  } else {
+    if (static_cast<SizeT>(shard.insertion_order.size()) >= shard_capacity_) {
+      shard.entry_dict.erase(shard.insertion_order.front());
+      shard.insertion_order.pop_front();
+    }
+    shard.insertion_order.push_back(key);
+  }
+  shard.entry_dict.emplace(key, Entry_{ header, is_valid });
+}
+
+
+template<typename BlockHeaderT>
+inline void ssybc::ValidationCache<BlockHeaderT>::Clear()
+{
+  for (auto &shard: shards_) {
+    std::lock_guard<std::mutex> const lock{ shard.mutex };
+    shard.entry_dict.clear();
+    shard.insertion_order.clear();
+  }
+}
+
+
+template<typename BlockHeaderT>
+inline auto ssybc::ValidationCache<BlockHeaderT>::Size() const -> SizeT
+{
+  SizeT result{ 0 };
+  for (auto const &shard: shards_) {
+    std::lock_guard<std::mutex> const lock{ shard.mutex };
+    result += static_cast<SizeT>(shard.entry_dict.size());
+  }
+  return result;
+}
+
+
+template<typename BlockHeaderT>
+inline auto ssybc::ValidationCache<BlockHeaderT>::Capacity() const -> SizeT
+{
+  return shard_capacity_ * kValidationCacheShardCount;
+}
+
+
+template<typename BlockHeaderT>
+inline auto ssybc::ValidationCache<BlockHeaderT>::HitCount() const -> SizeT
+{
+  return hit_count_.load();
+}
+
+
+template<typename BlockHeaderT>
+inline auto ssybc::ValidationCache<BlockHeaderT>::MissCount() const -> SizeT
+{
+  return miss_count_.load();
+}
+
+
+// The entry, its key in the map and in the insertion order, plus the map node and bucket pointers.
+template<typename BlockHeaderT>
+inline auto ssybc::ValidationCache<BlockHeaderT>::SizeOfEntry() -> SizeT
+{
+  return static_cast<SizeT>(sizeof(Entry_) + 2 * sizeof(Key_) + 3 * sizeof(void *));
+}
+
+
+// -------------------------------------------------- Type Definition -------------------------------------------------
+
+
+template<typename BlockHeaderT>
+inline bool ssybc::ValidationCache<BlockHeaderT>::Key_::operator==(Key_ const &key) const
+{
+  return header_hash == key.header_hash && validator_type == key.validator_type;
+}
+
+
+template<typename BlockHeaderT>
+inline auto ssybc::ValidationCache<BlockHeaderT>::KeyHasher_::operator()(Key_ const &key) const -> std::size_t
+{
+  return std::hash<BlockHash>()(key.header_hash) ^ (std::hash<std::type_index>()(key.validator_type) << 1);
+}
+
+
+// -------------------------------------------------- Private Method --------------------------------------------------
+
+
+template<typename BlockHeaderT>
+inline auto ssybc::ValidationCache<BlockHeaderT>::ShardOf_(BlockHash const &hash) const -> Shard_ &
+{
+  return shards_[std::hash<BlockHash>()(hash) % kValidationCacheShardCount];
+}
+
+
+#endif  // SSYBC_SRC_VALIDATOR_VALIDATION_CACHE_IMPL_HPP_
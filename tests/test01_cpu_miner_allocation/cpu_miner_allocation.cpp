@@ -0,0 +1,106 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+
+#include "include/ssybc/ssybc.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+
+
+// Every allocation of the process goes through here, so a test can count the allocations of one mining job.
+
+namespace {
+
+  std::atomic<std::size_t> allocation_count{ 0 };
+
+}
+
+
+void * operator new(std::size_t size)
+{
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (void * const pointer = std::malloc(size == 0 ? 1 : size)) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+
+void operator delete(void * pointer) noexcept
+{
+  std::free(pointer);
+}
+
+
+void operator delete(void * pointer, std::size_t) noexcept
+{
+  operator delete(pointer);
+}
+
+
+namespace {
+
+  // A header hashes to a valid genesis hash after about 2^8 nonces for the short job, and 2^20 nonces, many nonce
+  // batches, for the long job.
+  constexpr ssybc::HashDifficulty kShortJobDifficulty{ 8 };
+  constexpr ssybc::HashDifficulty kLongJobDifficulty{ 20 };
+  constexpr ssybc::SizeT kHashableBinarySize{ 96 };
+
+  template<template<typename> class Miner, ssybc::HashDifficulty Difficulty>
+  std::size_t AllocationCountOfMiningJob(std::shared_ptr<ssybc::MiningThreadPool> const &thread_pool_ptr)
+  {
+    using ValidatorType = ssybc::BlockValidatorLeadingZeroBits<ssybc::Block<std::string>, Difficulty>;
+    Miner<ValidatorType> const miner{ thread_pool_ptr };
+    ssybc::BinaryData const hashable_binary(kHashableBinarySize, ssybc::Byte{ 1 });
+    auto const count_before = allocation_count.load();
+    miner.MineGenesisInfo(hashable_binary);
+    return allocation_count.load() - count_before;
+  }
+
+  template<template<typename> class Miner>
+  bool MinerAllocatesTheSameForShortAndLongJobs(std::string const &miner_name)
+  {
+    auto const thread_pool_ptr = std::make_shared<ssybc::MiningThreadPool>(2);
+    // Warms up one-time allocations, e.g. function-local statics.
+    AllocationCountOfMiningJob<Miner, kShortJobDifficulty>(thread_pool_ptr);
+    auto const short_job_count = AllocationCountOfMiningJob<Miner, kShortJobDifficulty>(thread_pool_ptr);
+    auto const long_job_count = AllocationCountOfMiningJob<Miner, kLongJobDifficulty>(thread_pool_ptr);
+    std::cout << miner_name << " allocations per job, short: " << short_job_count << ", long: " << long_job_count
+      << std::endl;
+    return short_job_count == long_job_count;
+  }
+
+}
+
+
+int main() {
+  ssybc::logging::SetLoggerVerbosityLevel(ssybc::logging::LoggerVerbosity::kNoTest);
+
+  bool const brute_force_passed = MinerAllocatesTheSameForShortAndLongJobs<ssybc::BlockMinerCPUBruteForce>(
+    "BlockMinerCPUBruteForce");
+  bool const multi_buffer_passed = MinerAllocatesTheSameForShortAndLongJobs<ssybc::BlockMinerCPUMultiBuffer>(
+    "BlockMinerCPUMultiBuffer");
+  return brute_force_passed && multi_buffer_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
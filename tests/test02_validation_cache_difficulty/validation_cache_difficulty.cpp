@@ -0,0 +1,100 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+
+#include "include/ssybc/ssybc.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+
+// Validators of different difficulties share one ValidationCache, a verdict of one must never be taken by the other.
+
+namespace {
+
+  using EasyChain = ssybc::Blockchain<ssybc::Block<std::string>, 1, ssybc::BlockValidatorLeadingZeroBits>;
+  using HardChain = ssybc::Blockchain<ssybc::Block<std::string>, 24, ssybc::BlockValidatorLeadingZeroBits>;
+  using BlockType = EasyChain::BlockType;
+
+  static_assert(
+    std::is_same<EasyChain::ValidationCacheType, HardChain::ValidationCacheType>::value,
+    "Chains of different difficulties must be able to share a cache.");
+
+  bool Check(bool const condition, std::string const &description)
+  {
+    std::cout << description << ": " << condition << std::endl;
+    return condition;
+  }
+
+  bool EasyVerdictDoesNotLeakToHardValidator(BlockType const &block)
+  {
+    auto const cache_ptr = std::make_shared<EasyChain::ValidationCacheType>();
+    EasyChain::ValidatorType easy_validator{};
+    HardChain::ValidatorType hard_validator{};
+    easy_validator.SetValidationCachePtr(cache_ptr);
+    hard_validator.SetValidationCachePtr(cache_ptr);
+
+    bool passed{ Check(easy_validator.IsValidGenesisBlock(block), "Easy validator accepts block") };
+    passed &= Check(!hard_validator.IsValidGenesisBlock(block), "Hard validator rejects block after easy verdict");
+    passed &= Check(
+      hard_validator.FirstInvalidIndex(std::vector<BlockType>{ block }) == 0,
+      "Hard validator rejects batch after easy verdict");
+    passed &= Check(cache_ptr->Size() == 2, "Cache holds one verdict per validator");
+    return passed;
+  }
+
+  bool HardVerdictDoesNotLeakToEasyValidator(BlockType const &block)
+  {
+    auto const cache_ptr = std::make_shared<EasyChain::ValidationCacheType>();
+    EasyChain::ValidatorType easy_validator{};
+    HardChain::ValidatorType hard_validator{};
+    easy_validator.SetValidationCachePtr(cache_ptr);
+    hard_validator.SetValidationCachePtr(cache_ptr);
+
+    bool passed{ Check(!hard_validator.IsValidGenesisBlock(block), "Hard validator rejects block") };
+    passed &= Check(easy_validator.IsValidGenesisBlock(block), "Easy validator accepts block after hard verdict");
+    passed &= Check(
+      easy_validator.FirstInvalidIndex(std::vector<BlockType>{ block }) == 1,
+      "Easy validator accepts batch after hard verdict");
+    return passed;
+  }
+
+}
+
+
+int main() {
+  ssybc::logging::SetLoggerVerbosityLevel(ssybc::logging::LoggerVerbosity::kNoTest);
+
+  // Mined with at least 1 leading zero bit, 24 of them are unlikely enough for this block to be rejected by the hard
+  // validator.
+  auto const block = EasyChain::GenesisBlockMinedWithData("Genesis block of an easy chain.");
+  if (HardChain::ValidatorType().IsValidGenesisBlock(block)) {
+    std::cout << "Block meets the hard difficulty, nothing to test." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  bool const easy_first_passed = EasyVerdictDoesNotLeakToHardValidator(block);
+  bool const hard_first_passed = HardVerdictDoesNotLeakToEasyValidator(block);
+  return easy_first_passed && hard_first_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,195 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+
+#include "include/ssybc/ssybc.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef SSYBC_HAS_POSIX_SOCKETS
+#include <unistd.h>
+#endif
+
+
+// A mining pool on loopback: a coordinator, a worker that cheats and disconnects mid-job, then two honest workers.
+
+#ifdef SSYBC_HAS_POSIX_SOCKETS
+
+namespace {
+
+  using Chain = ssybc::Blockchain<ssybc::Block<std::string>, 16, ssybc::BlockValidatorLeadingZeroBits>;
+  using ValidatorType = Chain::ValidatorType;
+
+  constexpr ssybc::SizeT kAppendedBlockCount{ 3 };
+  constexpr ssybc::BlockTimeInterval kForgedTimeStampOffset{ 1000000 };
+  // Every check of one address has to finish within this, or the pool is taken as hung.
+  constexpr std::chrono::seconds kPoolTestTimeout{ 120 };
+
+  bool Check(bool const condition, std::string const &description)
+  {
+    std::cout << description << ": " << condition << std::endl;
+    return condition;
+  }
+
+  ssybc::BinaryData HashableBinaryOf(
+    ssybc::MiningPoolJob const &job,
+    ssybc::BlockTimeInterval const time_stamp,
+    ssybc::BlockNonce const nonce)
+  {
+    auto result = job.hashable_binary;
+    ssybc::util::UpdateBinaryDataWithTrailingTimeStampBeforeNonce(result, time_stamp);
+    ssybc::util::UpdateBinaryDataWithTrailingNonce(result, nonce);
+    return result;
+  }
+
+  // Takes the first job, sends a solution failing the proof of work and one with a time stamp of its own choosing
+  // that passes it, then disconnects without asking for more work. Returns the forged time stamp.
+  ssybc::BlockTimeInterval RunCheatingWorker(std::string const &address)
+  {
+    auto const connection_ptr = ssybc::MiningPoolConnection::Connect(address);
+    ssybc::MiningPoolMessage message{};
+    while (connection_ptr->Receive(message) && message.type != ssybc::MiningPoolMessageType::kJob) {
+      continue;
+    }
+    auto const job = ssybc::MiningPoolJobFromPayload(message.payload);
+    auto const hash_calculator = Chain::HeaderHashCalculatorType();
+    ValidatorType const validator{};
+
+    auto invalid_nonce = job.nonce_range.nonce_start;
+    while (validator.IsValidGenesisBlockHash(
+      hash_calculator.Hash(HashableBinaryOf(job, job.nonce_range.time_stamp, invalid_nonce)))) {
+      ++invalid_nonce;
+    }
+    connection_ptr->Send(
+      ssybc::MiningPoolMessageType::kSolution,
+      ssybc::MiningPoolSolutionPayload({ job.job_id, { job.nonce_range.time_stamp, invalid_nonce } }));
+
+    auto const forged_time_stamp = job.nonce_range.time_stamp + kForgedTimeStampOffset;
+    ssybc::BlockMinerCPUBruteForce<ValidatorType> const local_miner{ std::make_shared<ssybc::MiningThreadPool>(1) };
+    auto const forged_result = local_miner.MineGenesisInfo(
+      HashableBinaryOf(job, forged_time_stamp, ssybc::kDefaultNonce));
+    connection_ptr->Send(
+      ssybc::MiningPoolMessageType::kSolution,
+      ssybc::MiningPoolSolutionPayload({ job.job_id, forged_result }));
+
+    connection_ptr->Shutdown();
+    return forged_result.time_stamp;
+  }
+
+  bool WaitUntilWorkerCount(ssybc::MiningPoolCoordinator const &coordinator, ssybc::SizeT const worker_count)
+  {
+    auto const deadline = std::chrono::steady_clock::now() + kPoolTestTimeout;
+    while (coordinator.WorkerCount() != worker_count) {
+      if (std::chrono::steady_clock::now() > deadline) {
+        return false;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return true;
+  }
+
+  bool PoolMinesOnAddress(std::string const &address)
+  {
+    std::cout << "Mining pool on " << address << std::endl;
+    auto const coordinator_ptr = std::make_shared<ssybc::MiningPoolCoordinator>(address);
+    auto const miner_ptr = std::make_shared<ssybc::BlockMinerPoolCoordinator<ValidatorType>>(coordinator_ptr);
+
+    // Nobody mines honestly yet, so the genesis job can only be solved by a cheat the coordinator lets through.
+    auto genesis_future = std::async(std::launch::async, [&miner_ptr] {
+      return Chain::GenesisBlockMinedWithData("Genesis block mined on a pool.", *miner_ptr);
+    });
+    auto const forged_time_stamp = RunCheatingWorker(coordinator_ptr->Address());
+    bool passed{ Check(WaitUntilWorkerCount(*coordinator_ptr, 0), "Coordinator dropped the cheating worker") };
+
+    std::vector<std::unique_ptr<ssybc::MiningPoolWorker<ValidatorType>>> worker_ptrs{};
+    std::vector<std::thread> worker_threads{};
+    for (ssybc::SizeT i{ 0 }; i < 2; ++i) {
+      worker_ptrs.emplace_back(new ssybc::MiningPoolWorker<ValidatorType>(
+        coordinator_ptr->Address(),
+        std::make_shared<ssybc::BlockMinerCPUBruteForce<ValidatorType>>(std::make_shared<ssybc::MiningThreadPool>(1))));
+      auto &worker = *worker_ptrs.back();
+      worker_threads.emplace_back([&worker] { worker.Run(); });
+    }
+    passed &= Check(WaitUntilWorkerCount(*coordinator_ptr, 2), "Two workers connected");
+
+    auto const genesis_block = genesis_future.get();
+    passed &= Check(
+      genesis_block.Header().TimeStamp() != forged_time_stamp,
+      "Coordinator rejected the forged time stamp");
+    passed &= Check(ValidatorType().IsValidGenesisBlock(genesis_block), "Genesis block mined on the pool is valid");
+
+    Chain chain{ genesis_block };
+    chain.SetMinerPtr(miner_ptr);
+    for (ssybc::SizeT i{ 0 }; i < kAppendedBlockCount; ++i) {
+      chain.Append("Block " + std::to_string(i + 1) + " mined on a pool.");
+    }
+    passed &= Check(chain.Size() == kAppendedBlockCount + 1, "Blocks mined on the pool are appended");
+
+    ssybc::SizeT solution_count{ 0 };
+    for (auto const &worker_ptr : worker_ptrs) {
+      worker_ptr->Stop();
+      solution_count += worker_ptr->SolutionCount();
+    }
+    for (auto &worker_thread : worker_threads) {
+      worker_thread.join();
+    }
+    passed &= Check(solution_count >= kAppendedBlockCount + 1, "Workers sent a solution for every block");
+    coordinator_ptr->Shutdown();
+    return passed;
+  }
+
+  // Exits instead of returning if the pool hangs, a hung Mine() cannot be interrupted from here.
+  bool PoolMinesOnAddressWithinTimeout(std::string const &address)
+  {
+    auto result_future = std::async(std::launch::async, [&address] { return PoolMinesOnAddress(address); });
+    if (result_future.wait_for(kPoolTestTimeout) != std::future_status::ready) {
+      std::cout << "Mining pool on " << address << " hung." << std::endl;
+      std::_Exit(EXIT_FAILURE);
+    }
+    return result_future.get();
+  }
+
+}
+
+
+int main() {
+  ssybc::logging::SetLoggerVerbosityLevel(ssybc::logging::LoggerVerbosity::kNoTest);
+
+  bool const tcp_passed = PoolMinesOnAddressWithinTimeout("tcp://127.0.0.1:0");
+  bool const unix_passed = PoolMinesOnAddressWithinTimeout(
+    "unix:///tmp/ssybc_test_mining_pool_" + std::to_string(getpid()) + ".sock");
+  return tcp_passed && unix_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+#else
+
+int main() {
+  std::cout << "Mining pools need POSIX sockets, nothing to test." << std::endl;
+  return EXIT_SUCCESS;
+}
+
+#endif  // SSYBC_HAS_POSIX_SOCKETS
@@ -0,0 +1,96 @@
+/**********************************************************************************************************************
+ *
+ * Copyright (c) 2017-2018 Shuyang Sun
+ *
+ * License: MIT
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of
+ * the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+ * OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *********************************************************************************************************************/
+
+
+#include "include/ssybc/ssybc.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+
+// Parses the kernel's CPU lists and a sysfs fixture, "sysfs_cpu" next to this file, whose path is the first argument.
+// The fixture has CPUs 0-5 online: 0 and 2 share core 0, 1 and 3 share core 1, all on package 0, CPU 4 is core 0 of
+// package 1, and CPU 5 has no topology files. CPU 7 has topology files but is not online.
+
+namespace {
+
+  bool Check(bool const condition, std::string const &description)
+  {
+    std::cout << description << ": " << condition << std::endl;
+    return condition;
+  }
+
+  bool ParsesCPULists()
+  {
+    using ssybc::CPUTopology;
+    bool passed{ Check(
+      CPUTopology::CPUIdsFromList("0-3,8,10-11") == std::vector<ssybc::SizeT>{ 0, 1, 2, 3, 8, 10, 11 },
+      "Parses ranges and single CPUs") };
+    passed &= Check(CPUTopology::CPUIdsFromList("5") == std::vector<ssybc::SizeT>{ 5 }, "Parses a single CPU");
+    passed &= Check(CPUTopology::CPUIdsFromList("").empty(), "Parses an empty list");
+    passed &= Check(
+      CPUTopology::CPUIdsFromList("0-1,,4") == std::vector<ssybc::SizeT>{ 0, 1, 4 },
+      "Skips empty entries");
+    return passed;
+  }
+
+  bool ReadsSysfs(std::string const &cpu_directory)
+  {
+    auto const topology = ssybc::CPUTopology::FromSysfs(cpu_directory);
+    bool passed{ Check(
+      topology.CPUIds() == std::vector<ssybc::SizeT>{ 0, 1, 2, 3, 4, 5 },
+      "Reads online CPUs only") };
+    auto const &cpus = topology.LogicalCPUs();
+    passed &= Check(
+      cpus.size() == 6 && cpus[2].core_id == 0 && cpus[3].core_id == 1 && cpus[4].package_id == 1,
+      "Reads core and package ids");
+    passed &= Check(
+      cpus.size() == 6 && cpus[5].core_id == 5 && cpus[5].package_id == 0,
+      "CPU without topology files is its own core");
+    passed &= Check(topology.PhysicalCoreCount() == 4, "Counts physical cores");
+    passed &= Check(
+      topology.WithoutSMTSiblings().CPUIds() == std::vector<ssybc::SizeT>{ 0, 1, 4, 5 },
+      "Drops SMT siblings");
+    passed &= Check(
+      topology.WithoutFirstCores(1).CPUIds() == std::vector<ssybc::SizeT>{ 1, 3, 4, 5 },
+      "Drops every CPU of the first core");
+    passed &= Check(
+      topology.RestrictedTo({ 2, 4, 9 }).CPUIds() == std::vector<ssybc::SizeT>{ 2, 4 },
+      "Restricts to given CPUs");
+    passed &= Check(
+      ssybc::CPUTopology::FromSysfs(cpu_directory + "/missing").LogicalCPUs().empty(),
+      "Missing directory has no CPUs");
+    return passed;
+  }
+
+}
+
+
+int main(int const argc, char const **argv) {
+  if (argc < 2) {
+    std::cout << "Usage: " << argv[0] << " <sysfs cpu fixture directory>" << std::endl;
+    return EXIT_FAILURE;
+  }
+  bool const lists_passed = ParsesCPULists();
+  bool const sysfs_passed = ReadsSysfs(argv[1]);
+  return lists_passed && sysfs_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}